@@ -0,0 +1,115 @@
+/**
+* @file asyncFileBenchmark.cpp
+* @brief Benchmark of AsyncFileSink Against Blocking write for Filled ByteStreambuf Blocks
+*
+* A recorder fills blocks and hands them off. We report the time the recording thread spends blocked
+* handing blocks off, and the total time until the data is written, for a blocking write per block and
+* for AsyncFileSink with each backend.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "AsyncFileSink.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t blockSize = 1048576;
+    constexpr unsigned numBlocks = 128;
+
+    using Clock = std::chrono::steady_clock;
+
+    double milliseconds( Clock::duration elapsed )
+    {
+        return std::chrono::duration< double, std::milli >( elapsed ).count();
+    }
+
+    void fill( ByteStreambuf & block, uint32_t & sequence )
+    {
+        while ( typeToNet( sequence, block ) ) ++sequence;
+    }
+
+    void report( const char * pName, Clock::duration handOff, Clock::duration total )
+    {
+        std::cout << pName << ": hand off " << milliseconds( handOff ) << " ms, total " << milliseconds( total )
+                  << " ms, " << double( blockSize ) * numBlocks / 1e9 / std::chrono::duration< double >( total ).count()
+                  << " GB/s" << std::endl;
+    }
+
+    void runBlockingWrite( const std::string & path )
+    {
+        const int fd = open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+        if ( 0 > fd ) return;
+        std::vector< unsigned char > buffer( blockSize );
+        ByteStreambuf block( buffer.data(), std::streamsize( buffer.size() ), std::ios_base::out );
+
+        uint32_t sequence = 0;
+        Clock::duration handOff{ 0 };
+        const auto start = Clock::now();
+        for ( unsigned i = 0; numBlocks != i; ++i )
+        {
+            block.pubsetbuf( buffer.data(), std::streamsize( buffer.size() ) );
+            fill( block, sequence );
+            const auto handOffStart = Clock::now();
+            if ( ssize_t( blockSize ) != write( fd, buffer.data(), blockSize ) ) break;
+            handOff += Clock::now() - handOffStart;
+        }
+        fsync( fd );
+        close( fd );
+        report( "Blocking write", handOff, Clock::now() - start );
+    }
+
+    void runSink( const std::string & path, const char * pName, bool directIo, AsyncIoBackend backend )
+    {
+        AsyncFileSink sink( path.c_str(), blockSize, 8, directIo, backend );
+
+        uint32_t sequence = 0;
+        Clock::duration handOff{ 0 };
+        const auto start = Clock::now();
+        for ( unsigned i = 0; numBlocks != i; ++i )
+        {
+            auto handOffStart = Clock::now();
+            ByteStreambuf & block = sink.acquire();
+            handOff += Clock::now() - handOffStart;
+            fill( block, sequence );
+            handOffStart = Clock::now();
+            sink.submit( block );
+            handOff += Clock::now() - handOffStart;
+        }
+        sink.flush();
+        const int fd = open( path.c_str(), O_WRONLY | O_CLOEXEC );
+        if ( 0 <= fd )
+        {
+            fsync( fd );
+            close( fd );
+        }
+        report( pName, handOff, Clock::now() - start );
+    }
+}
+
+int main()
+{
+    const char * pTmpDir = getenv( "TMPDIR" );
+    const std::string path = std::string( pTmpDir ? pTmpDir : "/tmp" ) + "/asyncFileBenchmark.bin";
+
+    runBlockingWrite( path );
+    runSink( path, "AsyncFileSink io_uring", false, AsyncIoBackend::automatic );
+    runSink( path, "AsyncFileSink io_uring O_DIRECT", true, AsyncIoBackend::automatic );
+    runSink( path, "AsyncFileSink thread pool", false, AsyncIoBackend::threadPool );
+
+    unlink( path.c_str() );
+    return 0;
+}
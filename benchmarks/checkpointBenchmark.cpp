@@ -0,0 +1,77 @@
+/**
+* @file checkpointBenchmark.cpp
+* @brief Benchmark of Speculative Parse Rewinding with tellg and seekg Against ByteStreamCheckpoint
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "ByteStreamCheckpoint.h"
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t numMessages = 1 << 20;
+
+    double nanosecondsPerMessage( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) /
+               double( numMessages );
+    }
+}
+
+int main()
+{
+    // Each message is a 16-bit type and a 32-bit value. The first interpretation tried always fails on the type.
+    std::vector< unsigned char > messages( numMessages * 6 );
+    ByteStreambuf outByteStreambuf{ messages.data(), std::streamsize( messages.size() ), std::ios::out };
+    for ( size_t i = 0; numMessages != i; ++i )
+    {
+        typeToNet( uint16_t( 2 ), outByteStreambuf );
+        typeToNet( uint32_t( i ), outByteStreambuf );
+    }
+
+    ByteStreambuf byteStreambuf{ messages.data(), std::streamsize( messages.size() ), std::ios::in };
+    InputByteStream inputByteStream{ &byteStreambuf };
+
+    uint64_t checksum1 = 0;
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t i = 0; numMessages != i; ++i )
+    {
+        const auto pos = inputByteStream.tellg();
+        if ( 1 != netToType< uint16_t >( inputByteStream ) )
+        {
+            inputByteStream.clear();
+            inputByteStream.seekg( pos );
+        }
+        netToType< uint16_t >( inputByteStream );
+        checksum1 += netToType< uint32_t >( inputByteStream );
+    }
+    const auto seekElapsed = std::chrono::steady_clock::now() - start;
+
+    inputByteStream.seekg( 0 );
+    uint64_t checksum2 = 0;
+    start = std::chrono::steady_clock::now();
+    for ( size_t i = 0; numMessages != i; ++i )
+    {
+        {
+            ByteStreamCheckpoint checkpoint( byteStreambuf, &inputByteStream );
+            if ( 1 == netToType< uint16_t >( inputByteStream ) ) checkpoint.commit();
+        }
+        netToType< uint16_t >( inputByteStream );
+        checksum2 += netToType< uint32_t >( inputByteStream );
+    }
+    const auto checkpointElapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "tellg and seekg: " << nanosecondsPerMessage( seekElapsed ) << " ns/message" << std::endl
+              << "ByteStreamCheckpoint: " << nanosecondsPerMessage( checkpointElapsed ) << " ns/message"
+              << ( checksum1 == checksum2 ? "" : " (MISMATCH)" ) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+* @file compressionBenchmark.cpp
+* @brief Benchmark of LzBlockCodec and the Compressing Byte Stream Buffers on Telemetry Records
+*
+* Reports the compression ratio and throughput, in uncompressed GB/s, of the block codec alone and of
+* the full stream pipeline serializing records with typeToNet through a CompressingByteStreambuf
+* and decoding them with netToType through a DecompressingByteStreambuf.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "LzBlockCodec.h"
+#include "CompressingByteStreambuf.h"
+#include "DecompressingByteStreambuf.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t blockSize = 65536;
+    constexpr uint32_t numRecords = 200000;
+
+    // Decodes through the output argument form of netToType into a value initialized result. The returning form
+    // leaves the result indeterminate upon a short read, which GCC warns of once ByteStreambuf is inlined.
+    template < typename T >
+    T decode( InputByteStream & inputByteStream )
+    {
+        T t{};
+        netToType( inputByteStream, t );
+        return t;
+    }
+
+    // A typical telemetry record. A message type, a sequence number, a nanosecond timestamp, four
+    // slowly changing samples and a status word. 48 bytes on the wire.
+    template < typename Stream >
+    void serializeRecord( uint32_t i, Stream & stream )
+    {
+        typeToNet( uint16_t( 0x0100 + i % 4 ), stream );
+        typeToNet( i, stream );
+        typeToNet( uint64_t( 1700000000000000000ULL + uint64_t( i ) * 1000000 + i % 7 ), stream );
+        for ( int channel = 0; 4 != channel; ++channel )
+            typeToNet( std::round( 1000.0 * std::sin( i * 0.001 + channel ) ) / 1000.0, stream );
+        typeToNet( uint16_t( 0 == i % 1000 ? 1 : 0 ), stream );
+    }
+
+    double gigabytesPerSecond( uint64_t bytes, std::chrono::steady_clock::duration elapsed )
+    {
+        const std::chrono::duration< double > seconds = elapsed;
+        return double( bytes ) / seconds.count() / 1e9;
+    }
+}
+
+int main()
+{
+    // Serialize the raw records.
+    std::vector< unsigned char > raw( numRecords * 48 );
+    ByteStreambuf rawStreambuf{ raw.data(), std::streamsize( raw.size() ), std::ios::out };
+    for ( uint32_t i = 0; numRecords != i; ++i )
+        serializeRecord( i, rawStreambuf );
+
+    // The block codec alone.
+    std::vector< unsigned char > compressed( LzBlockCodec::compressBound( raw.size() ) );
+    std::vector< size_t > blockLengths;
+    auto start = std::chrono::steady_clock::now();
+    size_t compressedTotal = 0;
+    for ( size_t offset = 0; raw.size() > offset; offset += blockSize )
+    {
+        const size_t len = std::min( blockSize, raw.size() - offset );
+        const size_t clen = LzBlockCodec::compress( &raw[offset], len, &compressed[compressedTotal],
+                                                    compressed.size() - compressedTotal );
+        blockLengths.push_back( clen );
+        compressedTotal += clen;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "LzBlockCodec: ratio " << double( raw.size() ) / double( compressedTotal )
+              << ", compress " << gigabytesPerSecond( raw.size(), elapsed ) << " GB/s";
+
+    std::vector< unsigned char > decompressed( raw.size() );
+    start = std::chrono::steady_clock::now();
+    size_t compressedOffset = 0;
+    size_t rawOffset = 0;
+    for ( const auto clen : blockLengths )
+    {
+        rawOffset += LzBlockCodec::decompress( &compressed[compressedOffset], clen, &decompressed[rawOffset],
+                                               decompressed.size() - rawOffset );
+        compressedOffset += clen;
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << ", decompress " << gigabytesPerSecond( raw.size(), elapsed ) << " GB/s"
+              << ( decompressed == raw ? "" : " (MISMATCH)" ) << std::endl;
+
+    // The full stream pipeline.
+    std::vector< unsigned char > archive( LzBlockCodec::compressBound( raw.size() ) + raw.size() / 1000 );
+    ByteStreambuf archiveStreambuf{ archive.data(), std::streamsize( archive.size() ), std::ios::out };
+    OutputByteStream archiveOutStream{ &archiveStreambuf };
+    uint64_t archiveLength = 0;
+    start = std::chrono::steady_clock::now();
+    {
+        CompressingByteStreambuf compressingByteStreambuf{ archiveOutStream, blockSize };
+        OutputByteStream outputByteStream{ &compressingByteStreambuf };
+        for ( uint32_t i = 0; numRecords != i; ++i )
+            serializeRecord( i, outputByteStream );
+        outputByteStream.flush();
+        archiveLength = compressingByteStreambuf.bytesOut();
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Stream pipeline: ratio " << double( raw.size() ) / double( archiveLength )
+              << ", serialize and compress " << gigabytesPerSecond( raw.size(), elapsed ) << " GB/s";
+
+    ByteStreambuf archiveInStreambuf{ archive.data(), std::streamsize( archiveLength ), std::ios::in };
+    InputByteStream archiveInStream{ &archiveInStreambuf };
+    DecompressingByteStreambuf decompressingByteStreambuf{ archiveInStream, blockSize };
+    InputByteStream inputByteStream{ &decompressingByteStreambuf };
+    uint64_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for ( uint32_t i = 0; numRecords != i; ++i )
+    {
+        checksum += decode< uint16_t >( inputByteStream );
+        checksum += decode< uint32_t >( inputByteStream );
+        checksum += decode< uint64_t >( inputByteStream );
+        for ( int channel = 0; 4 != channel; ++channel )
+            checksum += uint64_t( 1000.0 * decode< double >( inputByteStream ) );
+        checksum += decode< uint16_t >( inputByteStream );
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << ", decompress and deserialize " << gigabytesPerSecond( raw.size(), elapsed ) << " GB/s"
+              << " (checksum " << checksum << ")" << std::endl;
+
+    return 0;
+}
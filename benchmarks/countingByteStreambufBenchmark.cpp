@@ -0,0 +1,108 @@
+/**
+* @file countingByteStreambufBenchmark.cpp
+* @brief Benchmark of Sizing Serialization with a Scratch ByteStreambuf Against a CountingByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "CountingByteStreambuf.h"
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t numMessages = 1 << 14;
+    constexpr size_t numValues = 64;
+    constexpr size_t blobSize = 4096;
+
+    double nanosecondsPerMessage( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) /
+               double( numMessages );
+    }
+
+    // A header, a run of values and a blob, as typical messages are serialized through a stream.
+    void serialize( const std::vector< unsigned char > & blob, OutputByteStream & stream )
+    {
+        typeToNet( uint32_t( 0xABCD ), stream );
+        for ( size_t i = 0; numValues != i; ++i ) typeToNet( double( i ), stream );
+        stream.write( blob.data(), std::streamsize( blob.size() ) );
+    }
+
+    // The same message serialized directly.
+    template < typename Buffer >
+    void serializeDirect( const std::vector< unsigned char > & blob, Buffer & buffer )
+    {
+        typeToNet( uint32_t( 0xABCD ), buffer );
+        for ( size_t i = 0; numValues != i; ++i ) typeToNet( double( i ), buffer );
+        buffer.sputn( blob.data(), std::streamsize( blob.size() ) );
+    }
+}
+
+int main()
+{
+    const std::vector< unsigned char > blob( blobSize, 0x55 );
+    std::vector< unsigned char > scratch( 1 << 20 );
+    size_t total1 = 0;
+    size_t total2 = 0;
+    size_t total3 = 0;
+    size_t total4 = 0;
+
+    ByteStreambuf scratchByteStreambuf{ scratch.data(), std::streamsize( scratch.size() ), std::ios_base::out };
+    OutputByteStream scratchStream{ &scratchByteStreambuf };
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numMessages != n; ++n )
+    {
+        scratchStream.seekp( 0 );
+        serialize( blob, scratchStream );
+        total1 += size_t( scratchStream.tellp() );
+    }
+    const auto scratchElapsed = std::chrono::steady_clock::now() - start;
+
+    CountingByteStreambuf countingByteStreambuf;
+    OutputByteStream countingStream{ &countingByteStreambuf };
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numMessages != n; ++n )
+    {
+        countingByteStreambuf.reset();
+        serialize( blob, countingStream );
+        total2 += countingByteStreambuf.size();
+    }
+    const auto countingElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numMessages != n; ++n )
+    {
+        scratchByteStreambuf.pubseekpos( 0 );
+        serializeDirect( blob, scratchByteStreambuf );
+        total3 += size_t( scratchByteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) );
+    }
+    const auto scratchDirectElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numMessages != n; ++n )
+    {
+        countingByteStreambuf.reset();
+        serializeDirect( blob, countingByteStreambuf );
+        total4 += countingByteStreambuf.size();
+    }
+    const auto countingDirectElapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Sizing a " << total1 / numMessages << " byte message:" << std::endl
+              << "Scratch ByteStreambuf and tellp, through a stream: " << nanosecondsPerMessage( scratchElapsed )
+              << " ns" << std::endl
+              << "CountingByteStreambuf, through a stream: " << nanosecondsPerMessage( countingElapsed ) << " ns"
+              << ( total1 == total2 ? "" : " (MISMATCH)" ) << std::endl
+              << "Scratch ByteStreambuf, direct: " << nanosecondsPerMessage( scratchDirectElapsed ) << " ns"
+              << ( total1 == total3 ? "" : " (MISMATCH)" ) << std::endl
+              << "CountingByteStreambuf, direct: " << nanosecondsPerMessage( countingDirectElapsed ) << " ns"
+              << ( total1 == total4 ? "" : " (MISMATCH)" ) << std::endl;
+
+    return 0;
+}
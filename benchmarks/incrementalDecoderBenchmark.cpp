@@ -0,0 +1,85 @@
+/**
+* @file incrementalDecoderBenchmark.cpp
+* @brief Benchmark of Decoding a Segmented Message by Restarting Against Resuming with an IncrementalDecoder
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "IncrementalDecoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr uint32_t numSamples = 1 << 18;
+    constexpr size_t segmentSize = 1460;
+
+    double millisecondsElapsed( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() ) / 1000.0;
+    }
+
+    // An attempt to decode the whole message from the start of what has been received so far,
+    // abandoned when the bytes run out, as a decoder unable to suspend must do.
+    bool decodeFromStart( const unsigned char * pBytes, size_t len, std::vector< uint32_t > & samples )
+    {
+        ConstByteStreambuf received{ pBytes, std::streamsize( len ) };
+        uint32_t count;
+        if ( 0 == netToType( received, count ) ) return false;
+        samples.resize( count );
+        for ( auto & sample : samples )
+            if ( 0 == netToType( received, sample ) ) return false;
+        return true;
+    }
+}
+
+int main()
+{
+    std::vector< unsigned char > wire( 4 + numSamples * 4 );
+    ByteStreambuf out{ wire.data(), std::streamsize( wire.size() ), std::ios_base::out };
+    typeToNet( numSamples, out );
+    for ( uint32_t i = 0; numSamples != i; ++i ) typeToNet( i * 2654435761U, out );
+
+    // Restarting: each segment is appended to what was received and the whole is decoded again.
+    std::vector< uint32_t > restarted;
+    size_t attempts = 0;
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t received = 0; wire.size() != received; )
+    {
+        received = std::min( wire.size(), received + segmentSize );
+        ++attempts;
+        if ( decodeFromStart( wire.data(), received, restarted ) ) break;
+    }
+    const auto restartElapsed = std::chrono::steady_clock::now() - start;
+
+    // Resuming: each segment is decoded as it arrives and then discarded.
+    std::vector< uint32_t > resumed;
+    uint32_t count;
+    IncrementalDecoder decoder;
+    decoder.field( count ).array( resumed, count, numSamples );
+    start = std::chrono::steady_clock::now();
+    for ( size_t offset = 0; wire.size() != offset; )
+    {
+        const size_t len = std::min( segmentSize, wire.size() - offset );
+        ConstByteStreambuf segment{ wire.data() + offset, std::streamsize( len ) };
+        offset += len;
+        if ( IncrementalDecoder::Status::incomplete != decoder.decode( segment ) ) break;
+    }
+    const auto resumeElapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Decoding a " << wire.size() << " byte message received in " << attempts << " segments of "
+              << segmentSize << " bytes:" << std::endl
+              << "Restarting from the first byte: " << millisecondsElapsed( restartElapsed ) << " ms" << std::endl
+              << "Resuming with an IncrementalDecoder: " << millisecondsElapsed( resumeElapsed ) << " ms"
+              << ( restarted == resumed ? "" : " (MISMATCH)" ) << std::endl;
+
+    return 0;
+}
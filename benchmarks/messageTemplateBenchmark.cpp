@@ -0,0 +1,87 @@
+/**
+* @file messageTemplateBenchmark.cpp
+* @brief Benchmark of Encoding Mostly Constant Messages Field by Field Against a MessageTemplate
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "MessageTemplate.h"
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t numMessages = 1 << 16;
+    constexpr size_t numPasses = 64;
+
+    double nanosecondsPerMessage( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) /
+               double( numMessages * numPasses );
+    }
+
+    // A heartbeat of a magic number, version, source identifier, flags, reserved words, sequence number and timestamp.
+    void encodeFields( ByteStreambuf & byteStreambuf, uint32_t sequence, uint64_t timestamp )
+    {
+        typeToNet( uint16_t( 0x4842 ), byteStreambuf );
+        typeToNet( uint8_t( 3 ), byteStreambuf );
+        typeToNet( uint8_t( 0 ), byteStreambuf );
+        typeToNet( uint32_t( 0xA1B2C3D4 ), byteStreambuf );
+        for ( int i = 0; 6 != i; ++i )
+            typeToNet( uint32_t( 0 ), byteStreambuf );
+        typeToNet( sequence, byteStreambuf );
+        typeToNet( timestamp, byteStreambuf );
+    }
+}
+
+int main()
+{
+    MessageTemplate heartbeat;
+    heartbeat.appendConstant( uint16_t( 0x4842 ) );
+    heartbeat.appendConstant( uint8_t( 3 ) );
+    heartbeat.appendConstant( uint8_t( 0 ) );
+    heartbeat.appendConstant( uint32_t( 0xA1B2C3D4 ) );
+    for ( int i = 0; 6 != i; ++i )
+        heartbeat.appendConstant( uint32_t( 0 ) );
+    const auto sequenceField = heartbeat.appendField< uint32_t >();
+    const auto timestampField = heartbeat.appendField< uint64_t >();
+
+    std::vector< unsigned char > buffer( numMessages * heartbeat.size() );
+    ByteStreambuf byteStreambuf{ buffer.data(), std::streamsize( buffer.size() ), std::ios::out };
+
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t pass = 0; numPasses != pass; ++pass )
+    {
+        byteStreambuf.pubseekpos( 0, std::ios_base::out );
+        for ( size_t i = 0; numMessages != i; ++i )
+            encodeFields( byteStreambuf, uint32_t( i ), uint64_t( pass * numMessages + i ) );
+    }
+    const auto fieldsElapsed = std::chrono::steady_clock::now() - start;
+    const auto fieldsChecksum = buffer[ buffer.size() - 1 ];
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t pass = 0; numPasses != pass; ++pass )
+    {
+        byteStreambuf.pubseekpos( 0, std::ios_base::out );
+        for ( size_t i = 0; numMessages != i; ++i )
+        {
+            unsigned char * pMessage = heartbeat.write( byteStreambuf );
+            MessageTemplate::patch( pMessage, sequenceField, uint32_t( i ) );
+            MessageTemplate::patch( pMessage, timestampField, uint64_t( pass * numMessages + i ) );
+        }
+    }
+    const auto templateElapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << heartbeat.size() << " byte heartbeat" << std::endl
+              << "Field by field typeToNet: " << nanosecondsPerMessage( fieldsElapsed ) << " ns/message" << std::endl
+              << "MessageTemplate: " << nanosecondsPerMessage( templateElapsed ) << " ns/message"
+              << ( fieldsChecksum == buffer[ buffer.size() - 1 ] ? "" : " (MISMATCH)" ) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+* @file parallelSerializerBenchmark.cpp
+* @brief Benchmark of Serial Against Parallel Serialization of a Large Batch Across Thread Counts
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "ParallelSerializer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t numRecords = 1 << 17;
+    constexpr size_t samplesPerRecord = 16;
+    constexpr size_t numPasses = 8;
+
+    // A telemetry record: a header and a run of samples, each serialized through typeToNet.
+    struct Record
+    {
+        uint64_t timestamp;
+        uint32_t id;
+        float samples[ samplesPerRecord ];
+    };
+
+    constexpr size_t wireSize = sizeof( uint64_t ) + sizeof( uint32_t ) + samplesPerRecord * sizeof( float );
+
+    void write( const Record & record, ByteStreambuf & byteStreambuf )
+    {
+        typeToNet( record.timestamp, byteStreambuf );
+        typeToNet( record.id, byteStreambuf );
+        for ( auto sample : record.samples ) typeToNet( sample, byteStreambuf );
+    }
+
+    double millisecondsPerBatch( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() ) /
+               1000.0 / double( numPasses );
+    }
+}
+
+int main()
+{
+    std::vector< Record > records( numRecords );
+    for ( size_t i = 0; numRecords != i; ++i )
+    {
+        records[i].timestamp = 1000000 * i;
+        records[i].id = uint32_t( i );
+        for ( size_t s = 0; samplesPerRecord != s; ++s ) records[i].samples[s] = float( i ) + float( s ) * 0.5f;
+    }
+
+    std::vector< unsigned char > serial( numRecords * wireSize );
+    std::vector< unsigned char > parallel( serial.size() );
+    std::cout << "Batch of " << numRecords << " records, " << serial.size() / 1024 << " KiB" << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t pass = 0; numPasses != pass; ++pass )
+    {
+        ByteStreambuf byteStreambuf{ serial.data(), std::streamsize( serial.size() ), std::ios_base::out };
+        for ( const auto & record : records ) write( record, byteStreambuf );
+    }
+    const auto serialElapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Serial: " << millisecondsPerBatch( serialElapsed ) << " ms/batch" << std::endl;
+
+    const unsigned maxThreads = std::max( 4U, std::thread::hardware_concurrency() );
+    for ( unsigned numThreads = 1; maxThreads >= numThreads; numThreads *= 2 )
+    {
+        ParallelSerializer serializer( numThreads );
+        bool ok = true;
+        start = std::chrono::steady_clock::now();
+        for ( size_t pass = 0; numPasses != pass; ++pass )
+        {
+            ByteStreambuf byteStreambuf{ parallel.data(), std::streamsize( parallel.size() ), std::ios_base::out };
+            serializer.plan( numRecords, []( size_t ) { return wireSize; } );
+            ok = serializer.serialize( byteStreambuf,
+                                       [&]( size_t i, ByteStreambuf & region ) { write( records[i], region ); } ) && ok;
+        }
+        const auto parallelElapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << numThreads << " threads: " << millisecondsPerBatch( parallelElapsed ) << " ms/batch, speedup "
+                  << double( serialElapsed.count() ) / double( parallelElapsed.count() )
+                  << ( ok && serial == parallel ? "" : " (MISMATCH)" ) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+* @file quantizedFloatBenchmark.cpp
+* @brief Benchmark of Float Array Serialization at Full, Half and Fixed Point Precision
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "QuantizedFloat.h"
+
+#include <chrono>
+#include <vector>
+#include <cmath>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t numValues = 1 << 16;
+    constexpr size_t numPasses = 256;
+
+    double nanosecondsPerValue( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) /
+               double( numValues * numPasses );
+    }
+
+    template< typename Encode, typename Decode >
+    void run( const char * pName, const std::vector< float > & values, std::vector< unsigned char > & buffer,
+              Encode encode, Decode decode )
+    {
+        std::vector< float > decoded( numValues );
+        ByteStreambuf byteStreambuf{ buffer.data(), std::streamsize( buffer.size() ) };
+
+        auto start = std::chrono::steady_clock::now();
+        for ( size_t pass = 0; numPasses != pass; ++pass )
+        {
+            byteStreambuf.pubseekpos( 0, std::ios_base::out );
+            encode( byteStreambuf );
+        }
+        const auto encodeElapsed = std::chrono::steady_clock::now() - start;
+        const auto bytes = byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out );
+
+        start = std::chrono::steady_clock::now();
+        for ( size_t pass = 0; numPasses != pass; ++pass )
+        {
+            byteStreambuf.pubseekpos( 0, std::ios_base::in );
+            decode( byteStreambuf, decoded.data() );
+        }
+        const auto decodeElapsed = std::chrono::steady_clock::now() - start;
+
+        double maxError = 0.0;
+        for ( size_t i = 0; numValues != i; ++i )
+        {
+            const double error = std::fabs( double( decoded[i] ) - double( values[i] ) );
+            if ( error > maxError ) maxError = error;
+        }
+
+        std::cout << pName << ": " << double( bytes ) / double( numValues ) << " bytes/value, encode "
+                  << nanosecondsPerValue( encodeElapsed ) << " ns/value, decode "
+                  << nanosecondsPerValue( decodeElapsed ) << " ns/value, max error " << maxError << std::endl;
+    }
+}
+
+int main()
+{
+    // A sampled waveform within +/- 100.
+    std::vector< float > values( numValues );
+    for ( size_t i = 0; numValues != i; ++i )
+        values[i] = 100.0f * std::sin( float( i ) * 0.001f ) * std::cos( float( i ) * 0.0173f );
+    std::vector< unsigned char > buffer( numValues * sizeof( float ) );
+
+    std::cout << "F16C in use " << QuantizedFloat::usingF16c() << std::endl;
+
+    run( "typeToNet< float >", values, buffer,
+         [&]( ByteStreambuf & b ) { for ( auto value : values ) typeToNet( value, b ); },
+         [&]( ByteStreambuf & b, float * p ) { for ( size_t i = 0; numValues != i; ++i ) p[i] = netToType< float >( b ); } );
+    run( "Half precision", values, buffer,
+         [&]( ByteStreambuf & b ) { QuantizedFloat::halfToNet( values.data(), numValues, b ); },
+         [&]( ByteStreambuf & b, float * p ) { QuantizedFloat::netToHalf( b, p, numValues ); } );
+    run( "Fixed point, 2 bytes", values, buffer,
+         [&]( ByteStreambuf & b ) { QuantizedFloat::fixedToNet( values.data(), numValues, 256.0f, 2, b ); },
+         [&]( ByteStreambuf & b, float * p ) { QuantizedFloat::netToFixed( b, p, numValues, 256.0f, 2 ); } );
+    run( "Fixed point, 1 byte", values, buffer,
+         [&]( ByteStreambuf & b ) { QuantizedFloat::fixedToNet( values.data(), numValues, 1.0f, 1, b ); },
+         [&]( ByteStreambuf & b, float * p ) { QuantizedFloat::netToFixed( b, p, numValues, 1.0f, 1 ); } );
+
+    return 0;
+}
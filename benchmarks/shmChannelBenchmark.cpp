@@ -0,0 +1,170 @@
+/**
+* @file shmChannelBenchmark.cpp
+* @brief Benchmark of Unix Socket Against Shared Memory Channel Message Passing Between Processes
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "ShmChannel.h"
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr uint32_t numMessages = 1 << 20;
+    constexpr uint32_t numRoundTrips = 1 << 14;
+    constexpr size_t messageSize = 64;
+
+    double nanosecondsPer( std::chrono::steady_clock::duration elapsed, uint32_t count )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) / double( count );
+    }
+
+    // The message serialized in both cases. With sockets it is serialized into a local buffer and sent.
+    void serialize( uint32_t sequence, ByteStreambuf & byteStreambuf )
+    {
+        typeToNet( sequence, byteStreambuf );
+        for ( size_t i = 4; messageSize != i; i += 4 ) typeToNet( sequence ^ uint32_t( i ), byteStreambuf );
+    }
+
+    // Receives a message and returns its sequence number in a reply.
+    bool echo( ShmChannel & in, ShmChannel & out )
+    {
+        if ( !in.receive() ) return false;
+        const uint32_t sequence = netToType< uint32_t >( in.streambuf() );
+        in.release();
+        serialize( sequence, *out.acquire() );
+        out.publish();
+        return true;
+    }
+
+    void waitForChild( pid_t pid )
+    {
+        int status;
+        waitpid( pid, &status, 0 );
+    }
+}
+
+int main()
+{
+    std::cout.flush();
+
+    // Throughput over a Unix socket.
+    int sockets[2];
+    socketpair( AF_UNIX, SOCK_SEQPACKET, 0, sockets );
+    pid_t pid = fork();
+    if ( 0 == pid )
+    {
+        unsigned char buffer[ messageSize ];
+        uint64_t sum = 0;
+        for ( uint32_t n = 0; numMessages != n; ++n )
+        {
+            if ( messageSize != size_t( read( sockets[1], buffer, sizeof( buffer ) ) ) ) _exit( 1 );
+            ByteStreambuf byteStreambuf{ buffer, messageSize, std::ios_base::in };
+            sum += netToType< uint32_t >( byteStreambuf );
+        }
+        _exit( uint64_t( numMessages ) * ( numMessages - 1 ) / 2 == sum ? 0 : 1 );
+    }
+    auto start = std::chrono::steady_clock::now();
+    for ( uint32_t n = 0; numMessages != n; ++n )
+    {
+        unsigned char buffer[ messageSize ];
+        ByteStreambuf byteStreambuf{ buffer, messageSize, std::ios_base::out };
+        serialize( n, byteStreambuf );
+        if ( messageSize != size_t( write( sockets[0], buffer, sizeof( buffer ) ) ) ) break;
+    }
+    waitForChild( pid );
+    const auto socketElapsed = std::chrono::steady_clock::now() - start;
+
+    // Throughput over a shared memory channel.
+    {
+        ShmChannel channel( messageSize, 1024 );
+        pid = fork();
+        if ( 0 == pid )
+        {
+            uint64_t sum = 0;
+            while ( channel.receive() )
+            {
+                sum += netToType< uint32_t >( channel.streambuf() );
+                channel.release();
+            }
+            _exit( uint64_t( numMessages ) * ( numMessages - 1 ) / 2 == sum ? 0 : 1 );
+        }
+        start = std::chrono::steady_clock::now();
+        for ( uint32_t n = 0; numMessages != n; ++n )
+        {
+            serialize( n, *channel.acquire() );
+            channel.publish();
+        }
+        channel.close();
+        waitForChild( pid );
+    }
+    const auto channelElapsed = std::chrono::steady_clock::now() - start;
+
+    // Round trip latency over a Unix socket.
+    pid = fork();
+    if ( 0 == pid )
+    {
+        unsigned char buffer[ messageSize ];
+        while ( messageSize == size_t( read( sockets[1], buffer, sizeof( buffer ) ) ) )
+            if ( messageSize != size_t( write( sockets[1], buffer, sizeof( buffer ) ) ) ) break;
+        _exit( 0 );
+    }
+    start = std::chrono::steady_clock::now();
+    for ( uint32_t n = 0; numRoundTrips != n; ++n )
+    {
+        unsigned char buffer[ messageSize ];
+        ByteStreambuf byteStreambuf{ buffer, messageSize, std::ios_base::out };
+        serialize( n, byteStreambuf );
+        if ( messageSize != size_t( write( sockets[0], buffer, sizeof( buffer ) ) ) ||
+             messageSize != size_t( read( sockets[0], buffer, sizeof( buffer ) ) ) ) break;
+    }
+    const auto socketRoundTripElapsed = std::chrono::steady_clock::now() - start;
+    shutdown( sockets[0], SHUT_WR );
+    waitForChild( pid );
+    close( sockets[0] );
+    close( sockets[1] );
+
+    // Round trip latency over a pair of shared memory channels.
+    std::chrono::steady_clock::duration roundTripElapsed;
+    {
+        ShmChannel ping( messageSize, 16 );
+        ShmChannel pong( messageSize, 16 );
+        pid = fork();
+        if ( 0 == pid )
+        {
+            while ( echo( ping, pong ) ) {}
+            _exit( 0 );
+        }
+        start = std::chrono::steady_clock::now();
+        for ( uint32_t n = 0; numRoundTrips != n; ++n )
+        {
+            serialize( n, *ping.acquire() );
+            ping.publish();
+            pong.receive();
+            pong.release();
+        }
+        roundTripElapsed = std::chrono::steady_clock::now() - start;
+        ping.close();
+        waitForChild( pid );
+    }
+
+    std::cout << "Throughput, " << messageSize << " byte messages:" << std::endl
+              << "Unix socket: " << nanosecondsPer( socketElapsed, numMessages ) << " ns/message" << std::endl
+              << "ShmChannel: " << nanosecondsPer( channelElapsed, numMessages ) << " ns/message" << std::endl
+              << "Round trip latency:" << std::endl
+              << "Unix socket: " << nanosecondsPer( socketRoundTripElapsed, numRoundTrips ) << " ns" << std::endl
+              << "ShmChannel: " << nanosecondsPer( roundTripElapsed, numRoundTrips ) << " ns"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+* @file slabArenaBenchmark.cpp
+* @brief Benchmark of Block Allocation and TLB Cost, SlabArena Against new unsigned char[]
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "SlabArena.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t blockSize = 2048;
+    constexpr size_t numBlocks = 32768;         // 64 MiB of blocks, far more than the TLB covers in normal pages.
+    constexpr size_t numAllocations = 1 << 22;
+    constexpr size_t numHeld = 256;
+    constexpr size_t numPasses = 4;
+    constexpr size_t numTrials = 7;            // The fastest trial of each is reported, as other load inflates the rest.
+
+    double nanosecondsPer( std::chrono::steady_clock::duration elapsed, size_t n )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) / double( n );
+    }
+
+    // Counts data TLB load misses of this thread in user space, where the kernel permits it.
+    class DtlbMissCounter
+    {
+    public:
+        DtlbMissCounter()
+        {
+            perf_event_attr attr{};
+            attr.size = sizeof( attr );
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+                          ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            _fd = int( syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) );
+        }
+        ~DtlbMissCounter() { if ( 0 <= _fd ) close( _fd ); }
+
+        bool available() const { return 0 <= _fd; }
+        void start() { if ( available() ) { ioctl( _fd, PERF_EVENT_IOC_RESET, 0 ); ioctl( _fd, PERF_EVENT_IOC_ENABLE, 0 ); } }
+        uint64_t stop()
+        {
+            uint64_t count = 0;
+            if ( available() && ( ioctl( _fd, PERF_EVENT_IOC_DISABLE, 0 ), sizeof( count ) != read( _fd, &count, sizeof( count ) ) ) )
+                count = 0;
+            return count;
+        }
+
+    private:
+        int _fd;
+    };
+
+    // Allocation and deallocation with a window of blocks held, as packets in flight are.
+    template < typename Allocate, typename Deallocate >
+    std::chrono::steady_clock::duration churn( Allocate allocate, Deallocate deallocate, size_t & checksum )
+    {
+        std::vector< unsigned char * > held( numHeld, nullptr );
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t n = 0; numAllocations != n; ++n )
+        {
+            unsigned char *& slot = held[ n % numHeld ];
+            deallocate( slot );
+            slot = allocate();
+            slot[0] = uint8_t( n );
+            checksum += slot[0];
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        for ( auto p : held ) deallocate( p );
+        return elapsed;
+    }
+
+    // Serializes a header into each block in a random order, as a receive path spread over many blocks does.
+    std::chrono::steady_clock::duration touch( const std::vector< unsigned char * > & blocks, DtlbMissCounter & counter,
+                                               uint64_t & misses, size_t & checksum )
+    {
+        std::vector< size_t > order( blocks.size() );
+        for ( size_t i = 0; order.size() != i; ++i ) order[i] = i;
+        std::shuffle( order.begin(), order.end(), std::mt19937( 12345 ) );
+
+        counter.start();
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t pass = 0; numPasses != pass; ++pass )
+        {
+            for ( size_t i : order )
+            {
+                ByteStreambuf byteStreambuf{ blocks[i], std::streamsize( blockSize ), std::ios_base::out };
+                typeToNet( uint32_t( pass ), byteStreambuf );
+                typeToNet( uint64_t( i ), byteStreambuf );
+                checksum += blocks[i][3];
+            }
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        misses = counter.stop();
+        return elapsed;
+    }
+}
+
+int main()
+{
+    size_t checksum = 0;
+    DtlbMissCounter counter;
+
+    // Allocation cost.
+    SlabArena arena{ blockSize, numBlocks };
+    auto newElapsed = std::chrono::steady_clock::duration::max();
+    auto arenaElapsed = std::chrono::steady_clock::duration::max();
+    for ( size_t trial = 0; numTrials != trial; ++trial )
+    {
+        newElapsed = std::min( newElapsed, churn( []() { return new unsigned char[ blockSize ]; },
+                                                  []( unsigned char * p ) { delete[] p; }, checksum ) );
+        arenaElapsed = std::min( arenaElapsed, churn( [&]() { return arena.allocate(); },
+                                                      [&]( unsigned char * p ) { arena.deallocate( p ); }, checksum ) );
+    }
+
+    // TLB cost. Every block is touched once beforehand so that page faults are not measured.
+    std::vector< unsigned char * > newBlocks( numBlocks );
+    for ( auto & p : newBlocks ) { p = new unsigned char[ blockSize ]; std::memset( p, 0, blockSize ); }
+    std::vector< unsigned char * > arenaBlocks( numBlocks );
+    for ( auto & p : arenaBlocks ) p = arena.allocate();
+
+    uint64_t newMisses = UINT64_MAX;
+    uint64_t arenaMisses = UINT64_MAX;
+    auto newTouchElapsed = std::chrono::steady_clock::duration::max();
+    auto arenaTouchElapsed = std::chrono::steady_clock::duration::max();
+    for ( size_t trial = 0; numTrials != trial; ++trial )
+    {
+        uint64_t misses = 0;
+        newTouchElapsed = std::min( newTouchElapsed, touch( newBlocks, counter, misses, checksum ) );
+        newMisses = std::min( newMisses, misses );
+        arenaTouchElapsed = std::min( arenaTouchElapsed, touch( arenaBlocks, counter, misses, checksum ) );
+        arenaMisses = std::min( arenaMisses, misses );
+    }
+
+    for ( auto p : newBlocks ) delete[] p;
+    for ( auto p : arenaBlocks ) arena.deallocate( p );
+
+    const size_t numTouches = numBlocks * numPasses;
+    std::cout << "Allocating and deallocating " << blockSize << " byte blocks, " << numHeld << " held:" << std::endl
+              << "new unsigned char[]: " << nanosecondsPer( newElapsed, numAllocations ) << " ns" << std::endl
+              << "SlabArena: " << nanosecondsPer( arenaElapsed, numAllocations ) << " ns" << std::endl
+              << "Serializing a header into " << numBlocks << " blocks in random order, huge pages "
+              << ( arena.hugePages() ? "reserved" : "requested" ) << ", NUMA node " << arena.numaNode() << ":" << std::endl
+              << "new unsigned char[]: " << nanosecondsPer( newTouchElapsed, numTouches ) << " ns";
+    if ( counter.available() ) std::cout << ", " << double( newMisses ) / double( numTouches ) << " dTLB misses";
+    std::cout << std::endl << "SlabArena: " << nanosecondsPer( arenaTouchElapsed, numTouches ) << " ns";
+    if ( counter.available() ) std::cout << ", " << double( arenaMisses ) / double( numTouches ) << " dTLB misses";
+    std::cout << std::endl << ( counter.available() ? "" : "(dTLB miss counting is unavailable)\n" )
+              << "Checksum " << checksum << std::endl;
+
+    return 0;
+}
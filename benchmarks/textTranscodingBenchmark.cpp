@@ -0,0 +1,101 @@
+/**
+* @file textTranscodingBenchmark.cpp
+* @brief Benchmark of Per Byte std::hex Formatting Against Vectorized Hex and Base64 Transcoding
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "TextTranscoding.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t packetSize = 1500;
+    constexpr size_t numPackets = 1 << 14;
+
+    double nanosecondsPerPacket( std::chrono::steady_clock::duration elapsed )
+    {
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) /
+               double( numPackets );
+    }
+}
+
+int main()
+{
+    std::vector< unsigned char > packet( packetSize );
+    for ( size_t i = 0; packetSize != i; ++i ) packet[i] = static_cast< unsigned char >( i * 131 + 7 );
+    std::vector< unsigned char > text( 2 * packetSize );
+    std::vector< unsigned char > decoded( packetSize );
+    size_t check = 0;
+
+    std::cout << "AVX2 in use " << TextTranscoding::usingAvx2() << ", SSSE3 in use "
+              << TextTranscoding::usingSsse3() << std::endl;
+
+    // The per byte formatting the test harnesses use when reporting values.
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numPackets != n; ++n )
+    {
+        std::ostringstream oss;
+        oss << std::hex << std::setfill( '0' );
+        for ( auto byte : packet ) oss << std::setw( 2 ) << unsigned( byte );
+        check += oss.str().size();
+    }
+    const auto streamElapsed = std::chrono::steady_clock::now() - start;
+
+    ByteStreambuf textByteStreambuf{ text.data(), std::streamsize( text.size() ) };
+    ByteStreambuf decodedByteStreambuf{ decoded.data(), std::streamsize( decoded.size() ) };
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numPackets != n; ++n )
+    {
+        textByteStreambuf.pubseekpos( 0, std::ios_base::out );
+        check += TextTranscoding::hexEncode( packet.data(), packetSize, textByteStreambuf );
+    }
+    const auto hexEncodeElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numPackets != n; ++n )
+    {
+        decodedByteStreambuf.pubseekpos( 0, std::ios_base::out );
+        check += TextTranscoding::hexDecode( text.data(), 2 * packetSize, decodedByteStreambuf );
+    }
+    const auto hexDecodeElapsed = std::chrono::steady_clock::now() - start;
+    const bool hexMatches = packet == decoded;
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numPackets != n; ++n )
+    {
+        textByteStreambuf.pubseekpos( 0, std::ios_base::out );
+        check += TextTranscoding::base64Encode( packet.data(), packetSize, textByteStreambuf );
+    }
+    const auto base64EncodeElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for ( size_t n = 0; numPackets != n; ++n )
+    {
+        decodedByteStreambuf.pubseekpos( 0, std::ios_base::out );
+        check += TextTranscoding::base64Decode( text.data(), TextTranscoding::base64EncodedSize( packetSize ),
+                                                decodedByteStreambuf );
+    }
+    const auto base64DecodeElapsed = std::chrono::steady_clock::now() - start;
+    const bool base64Matches = packet == decoded;
+
+    std::cout << "Per " << packetSize << " byte packet:" << std::endl
+              << "std::hex formatting: " << nanosecondsPerPacket( streamElapsed ) << " ns" << std::endl
+              << "hexEncode: " << nanosecondsPerPacket( hexEncodeElapsed ) << " ns" << std::endl
+              << "hexDecode: " << nanosecondsPerPacket( hexDecodeElapsed ) << " ns"
+              << ( hexMatches ? "" : " (MISMATCH)" ) << std::endl
+              << "base64Encode: " << nanosecondsPerPacket( base64EncodeElapsed ) << " ns" << std::endl
+              << "base64Decode: " << nanosecondsPerPacket( base64DecodeElapsed ) << " ns"
+              << ( base64Matches ? "" : " (MISMATCH)" ) << std::endl
+              << "(check " << check << ")" << std::endl;
+
+    return 0;
+}
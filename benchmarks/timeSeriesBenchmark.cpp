@@ -0,0 +1,115 @@
+/**
+* @file timeSeriesBenchmark.cpp
+* @brief Benchmark of Delta of Delta and XOR Time Series Encoding Against Plain typeToNet
+*
+* Encodes timestamp and sample pairs both with plain typeToNet, 16 bytes per pair, and with the time series
+* encoders, reporting payload size and throughput. Two sample profiles are used. Integral ADC style counts
+* which XOR well, and decimal rounded values which do not.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "TimeSeriesCodec.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t numSamples = 1000000;
+
+    double millionsPerSecond( size_t count, std::chrono::steady_clock::duration elapsed )
+    {
+        const std::chrono::duration< double > seconds = elapsed;
+        return double( count ) / seconds.count() / 1e6;
+    }
+
+    void run( const char * pProfile, const std::vector< int64_t > & timestamps, const std::vector< double > & samples )
+    {
+        std::vector< unsigned char > plain( numSamples * 16 );
+        std::vector< unsigned char > packed( numSamples * 16 + 64 );
+
+        // Plain typeToNet directly upon the stream buffer.
+        ByteStreambuf plainStreambuf{ plain.data(), std::streamsize( plain.size() ) };
+        auto start = std::chrono::steady_clock::now();
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            typeToNet( timestamps[i], plainStreambuf );
+            typeToNet( samples[i], plainStreambuf );
+        }
+        const auto plainEncode = std::chrono::steady_clock::now() - start;
+
+        size_t mismatches = 0;
+        start = std::chrono::steady_clock::now();
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            mismatches += netToType< int64_t >( plainStreambuf ) != timestamps[i];
+            mismatches += netToType< double >( plainStreambuf ) != samples[i];
+        }
+        const auto plainDecode = std::chrono::steady_clock::now() - start;
+
+        // Time series encoding.
+        ByteStreambuf packedStreambuf{ packed.data(), std::streamsize( packed.size() ) };
+        start = std::chrono::steady_clock::now();
+        BitWriter bitWriter{ packedStreambuf };
+        DeltaOfDeltaEncoder timestampEncoder{ bitWriter };
+        XorFloatEncoder sampleEncoder{ bitWriter };
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            timestampEncoder.encode( timestamps[i] );
+            sampleEncoder.encode( samples[i] );
+        }
+        bitWriter.flush();
+        const auto packedEncode = std::chrono::steady_clock::now() - start;
+        const auto packedBytes = bitWriter.bitsWritten() / 8;
+
+        start = std::chrono::steady_clock::now();
+        BitReader bitReader{ packedStreambuf };
+        DeltaOfDeltaDecoder timestampDecoder{ bitReader };
+        XorFloatDecoder sampleDecoder{ bitReader };
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            int64_t timestamp = 0;
+            double sample = 0.0;
+            timestampDecoder.decode( timestamp );
+            sampleDecoder.decode( sample );
+            mismatches += timestamp != timestamps[i] || sample != samples[i];
+        }
+        const auto packedDecode = std::chrono::steady_clock::now() - start;
+
+        std::cout << pProfile << ": " << double( packedBytes ) / numSamples << " bytes/sample, "
+                  << double( numSamples * 16 ) / double( packedBytes ) << "x smaller than typeToNet\n"
+                  << "  typeToNet encode " << millionsPerSecond( numSamples, plainEncode ) << " M/s, decode "
+                  << millionsPerSecond( numSamples, plainDecode ) << " M/s\n"
+                  << "  time series encode " << millionsPerSecond( numSamples, packedEncode ) << " M/s, decode "
+                  << millionsPerSecond( numSamples, packedDecode ) << " M/s"
+                  << ( 0 == mismatches ? "" : " (MISMATCH)" ) << std::endl;
+    }
+}
+
+int main()
+{
+    std::vector< int64_t > timestamps( numSamples );
+    std::vector< double > counts( numSamples );
+    std::vector< double > decimals( numSamples );
+    int64_t t = 1700000000000000000LL;
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        t += 1000000 + ( 0 == i % 100 ? 250 : 0 );
+        timestamps[i] = t;
+        counts[i] = std::round( 2048.0 + 20.0 * std::sin( double( i ) * 0.001 ) );
+        decimals[i] = std::round( 100.0 * std::sin( double( i ) * 0.001 ) ) / 100.0;
+    }
+
+    run( "Integral samples", timestamps, counts );
+    run( "Decimal samples", timestamps, decimals );
+
+    return 0;
+}
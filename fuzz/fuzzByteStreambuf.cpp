@@ -0,0 +1,94 @@
+/**
+* @file fuzzByteStreambuf.cpp
+* @brief Fuzz Target Exercising ByteStreambuf Seeks and Mixed Width Decodes
+*
+* The fuzz input is used both as the program and as the data. The program is a sequence of operation
+* bytes, each optionally followed by an operand, which seek within and decode from a stream over the data.
+* Both the stream and direct serialization paths are exercised and invariants are checked after every operation.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    // Abort on an invariant violation so that the fuzzer records the input.
+    void check( bool condition )
+    {
+        if ( !condition ) std::abort();
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size )
+{
+    constexpr size_t maxOperations = 4096;
+
+    ConstByteStreambuf programStreambuf{ pData, std::streamsize( size ) };
+    ConstByteStreambuf subjectStreambuf{ pData, std::streamsize( size ) };
+    InputByteStream subjectStream{ &subjectStreambuf };
+
+    // A writable copy, written to and read back at the same positions.
+    std::vector< unsigned char > scratch( pData, pData + size );
+    ByteStreambuf scratchStreambuf{ scratch.data(), std::streamsize( scratch.size() ) };
+    InputOutputByteStream scratchStream{ &scratchStreambuf };
+
+    for ( size_t i = 0; maxOperations != i; ++i )
+    {
+        uint8_t op;
+        if ( 0 == netToType( programStreambuf, op ) ) break;
+
+        switch ( op % 12 )
+        {
+            case 0: subjectStream.seekg( netToType< int16_t >( programStreambuf ), std::ios_base::cur ); break;
+            case 1: subjectStream.seekg( std::streampos( netToType< uint16_t >( programStreambuf ) ) ); break;
+            case 2: subjectStream.seekg( -std::streamoff( netToType< uint8_t >( programStreambuf ) ),
+                                         std::ios_base::end ); break;
+            case 3: netToType< uint16_t >( subjectStream ); break;
+            case 4: netToType< int32_t >( subjectStream ); break;
+            case 5: netToType< double >( subjectStream ); break;
+            case 6: netToType< uint64_t >( subjectStreambuf ); break;
+            case 7: netToType< float >( subjectStreambuf ); break;
+            case 8: subjectStream.clear(); break;
+            case 9:
+            {
+                // Write a value at the current put position and read it back from the same position.
+                const auto value = netToType< uint32_t >( programStreambuf );
+                const auto pos = scratchStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out );
+                if ( sizeof( value ) == typeToNet( value, scratchStreambuf ) )
+                {
+                    check( pos == scratchStreambuf.pubseekpos( pos, std::ios_base::in ) );
+                    uint32_t readBack = 0;
+                    check( sizeof( readBack ) == netToType( scratchStreambuf, readBack ) );
+                    check( value == readBack );
+                }
+                break;
+            }
+            case 10:
+                scratchStream.clear();
+                scratchStream.seekp( std::streampos( netToType< uint16_t >( programStreambuf ) ) );
+                typeToNet( netToType< uint16_t >( programStreambuf ), scratchStream );
+                break;
+            default:
+                scratchStreambuf.pubseekpos( 0, std::ios_base::in | std::ios_base::out );
+                break;
+        }
+
+        // The get position must remain within the buffer and agree between the stream and the buffer.
+        const auto avail = subjectStreambuf.in_avail();
+        check( 0 <= avail && std::streamsize( size ) >= avail );
+        const auto bufPos = subjectStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::in );
+        check( std::streamoff( bufPos ) + avail == std::streamoff( size ) );
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+* @file fuzzDatagramSplitter.cpp
+* @brief Fuzz Target Exercising DatagramSplitter over Hostile and Coalesced Datagrams
+*
+* The fuzz input is first split as a hostile datagram. Every message presented must lie within it, decode
+* safely through both its stream and its stream buffer, and the messages and their prefixes must account for
+* the whole datagram unless it is reported malformed. The input is then cut into messages, coalesced with
+* MessageCoalescer and split again, and the messages must come back unchanged.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "MessageCoalescer.h"
+#include "DatagramSplitter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    // Abort on an invariant violation so that the fuzzer records the input.
+    void check( bool condition )
+    {
+        if ( !condition ) std::abort();
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size )
+{
+    // Hostile datagram.
+    {
+        DatagramSplitter splitter{ pData, size };
+        size_t accounted = 0;
+        while ( InputByteStream * pMessage = splitter.next() )
+        {
+            ConstByteStreambuf & message = splitter.streambuf();
+            const unsigned char * pBegin = message.getAreaBegin();
+            const unsigned char * pEnd = message.getAreaEnd();
+            check( pData + accounted + CoalescedDatagramFormat::lengthPrefixSize == pBegin && pData + size >= pEnd );
+            accounted += CoalescedDatagramFormat::lengthPrefixSize + size_t( pEnd - pBegin );
+
+            netToType< uint16_t >( *pMessage );
+            netToType< uint32_t >( message );
+            while ( InputByteStream::traits_type::eof() != pMessage->get() ) {}
+        }
+        check( splitter.malformed() != ( size == accounted ) );
+        check( nullptr == splitter.next() );
+    }
+
+    // Coalesced round trip. Each message's length is taken from the byte preceding it.
+    std::vector< std::vector< unsigned char > > messages;
+    for ( size_t i = 0; size > i; )
+    {
+        const size_t len = std::min( size_t( pData[ i ] ) * 3, size - i - 1 );
+        messages.emplace_back( pData + i + 1, pData + i + 1 + len );
+        i += len + 1;
+    }
+
+    size_t numSplit = 0;
+    MessageCoalescer coalescer{ [&]( const unsigned char * pDatagram, size_t len )
+    {
+        check( 1472 >= len );
+        DatagramSplitter splitter{ pDatagram, len };
+        while ( splitter.next() )
+        {
+            const ConstByteStreambuf & message = splitter.streambuf();
+            check( messages.size() > numSplit );
+            const auto & expected = messages[ numSplit++ ];
+            check( expected.size() == size_t( message.getAreaEnd() - message.getAreaBegin() ) &&
+                   std::equal( expected.begin(), expected.end(), message.getAreaBegin() ) );
+        }
+        check( !splitter.malformed() );
+    } };
+    for ( const auto & message : messages ) check( coalescer.append( message.data(), message.size() ) );
+    coalescer.flush();
+    check( messages.size() == numSplit );
+
+    return 0;
+}
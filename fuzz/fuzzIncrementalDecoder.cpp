@@ -0,0 +1,157 @@
+/**
+* @file fuzzIncrementalDecoder.cpp
+* @brief Fuzz Target Exercising IncrementalDecoder over Hostile and Well Formed Segmented Messages
+*
+* The fuzz input is first decoded as a hostile stream of messages, cut into segments of a size taken from its
+* first byte. Each decode must consume only from the segment, report the bytes consumed consistently and, on
+* completing a message, leave its variable length fields sized by their counts. A message found invalid must stay
+* so, consuming nothing more, until reset. A message built from the input is then serialized and decoded in
+* segments, and must come back unchanged.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "IncrementalDecoder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t maxSamples = 1000;
+    constexpr size_t maxNameLength = 200;
+
+    // The count is signed so that negative counts are exercised as well as excessive ones.
+    struct Message
+    {
+        uint8_t type{};
+        int32_t id{};
+        int16_t count{};
+        std::vector< uint32_t > samples;
+        uint8_t nameLength{};
+        std::vector< unsigned char > name;
+        unsigned char trailer[ 3 ]{};
+        uint64_t sequence{};
+    };
+
+    // Abort on an invariant violation so that the fuzzer records the input.
+    void check( bool condition )
+    {
+        if ( !condition ) std::abort();
+    }
+
+    void describe( Message & message, IncrementalDecoder & decoder )
+    {
+        decoder.field( message.type ).field( message.id ).field( message.count )
+               .array( message.samples, message.count, maxSamples )
+               .field( message.nameLength ).bytes( message.name, message.nameLength, maxNameLength )
+               .bytes( message.trailer, sizeof( message.trailer ) ).skip( 2 ).field( message.sequence );
+    }
+
+    void serialize( const Message & message, ByteStreambuf & out )
+    {
+        typeToNet( message.type, out );
+        typeToNet( message.id, out );
+        typeToNet( message.count, out );
+        for ( auto sample : message.samples ) typeToNet( sample, out );
+        typeToNet( message.nameLength, out );
+        if ( !message.name.empty() )
+            std::memcpy( out.claimPutBytes( message.name.size() ), message.name.data(), message.name.size() );
+        std::memcpy( out.claimPutBytes( sizeof( message.trailer ) ), message.trailer, sizeof( message.trailer ) );
+        std::memset( out.claimPutBytes( 2 ), 0, 2 );
+        typeToNet( message.sequence, out );
+    }
+
+    size_t segmentSize( const uint8_t * pData, size_t size )
+    {
+        return size ? 1 + pData[0] % 32 : 1;
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size )
+{
+    // Hostile messages, one after another. Bytes consumed from segments must be those of the messages decoded.
+    {
+        Message message;
+        IncrementalDecoder decoder;
+        describe( message, decoder );
+
+        const size_t step = segmentSize( pData, size );
+        size_t segmentsConsumed = 0;
+        size_t messagesConsumed = 0;
+        for ( size_t offset = 0; size > offset; offset += step )
+        {
+            const size_t len = std::min( step, size - offset );
+            ConstByteStreambuf segment{ pData + offset, std::streamsize( len ) };
+            auto status = decoder.decode( segment );
+            while ( IncrementalDecoder::Status::complete == status )
+            {
+                check( size_t( message.count ) == message.samples.size() && maxSamples >= message.samples.size() );
+                check( message.nameLength == message.name.size() && maxNameLength >= message.name.size() );
+                messagesConsumed += decoder.consumed();
+                decoder.reset();
+                status = decoder.decode( segment );
+            }
+
+            const unsigned char * pGet = segment.position().pGet;
+            check( pData + offset <= pGet && pData + offset + len >= pGet );
+            check( IncrementalDecoder::Status::invalid == status || pData + offset + len == pGet );
+            segmentsConsumed += size_t( pGet - ( pData + offset ) );
+            check( messagesConsumed + decoder.consumed() == segmentsConsumed );
+
+            if ( IncrementalDecoder::Status::invalid == status )
+            {
+                const size_t consumed = decoder.consumed();
+                check( IncrementalDecoder::Status::invalid == decoder.decode( segment ) );
+                check( pGet == segment.position().pGet && consumed == decoder.consumed() );
+                break;
+            }
+        }
+        check( size >= segmentsConsumed );
+    }
+
+    // Round trip of a message built from the input.
+    Message expected;
+    expected.type = size ? pData[0] : 0;
+    expected.id = -int32_t( size );
+    expected.count = int16_t( std::min( size / 4, maxSamples ) );
+    ConstByteStreambuf input{ pData, std::streamsize( size ) };
+    for ( size_t i = 0; size_t( expected.count ) != i; ++i ) expected.samples.push_back( netToType< uint32_t >( input ) );
+    expected.nameLength = uint8_t( std::min( size, maxNameLength ) );
+    expected.name.assign( pData, pData + expected.nameLength );
+    std::memcpy( expected.trailer, "\x01\x02\x03", sizeof( expected.trailer ) );
+    expected.sequence = ( uint64_t( size ) << 32 ) | uint64_t( expected.count );
+
+    std::vector< unsigned char > wire( 32 + 4 * maxSamples + maxNameLength );
+    ByteStreambuf out{ wire.data(), std::streamsize( wire.size() ), std::ios_base::out };
+    serialize( expected, out );
+    const size_t wireLen = size_t( out.position().pPut - wire.data() );
+
+    Message message;
+    IncrementalDecoder decoder;
+    describe( message, decoder );
+    const size_t step = segmentSize( pData, size );
+    auto status = IncrementalDecoder::Status::incomplete;
+    for ( size_t offset = 0; wireLen > offset; offset += step )
+    {
+        check( IncrementalDecoder::Status::incomplete == status );
+        ConstByteStreambuf segment{ wire.data() + offset, std::streamsize( std::min( step, wireLen - offset ) ) };
+        status = decoder.decode( segment );
+    }
+    check( IncrementalDecoder::Status::complete == status && wireLen == decoder.consumed() );
+    check( expected.type == message.type && expected.id == message.id && expected.count == message.count &&
+           expected.samples == message.samples && expected.nameLength == message.nameLength &&
+           expected.name == message.name && 0 == std::memcmp( expected.trailer, message.trailer, 3 ) &&
+           expected.sequence == message.sequence );
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+* @file fuzzLzBlockCodec.cpp
+* @brief Fuzz Target Exercising LzBlockCodec Decompression and the Decompressing Byte Stream Buffer
+*
+* The fuzz input is first decompressed as a hostile block, into a generous and a tight output buffer, and then
+* read as a hostile archive of frames through a DecompressingByteStreambuf. Either must fail cleanly or produce
+* output within bounds. It is then compressed, as a block and as an archive, and must decompress to itself.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "LzBlockCodec.h"
+#include "CompressingByteStreambuf.h"
+#include "DecompressingByteStreambuf.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr size_t maxBlockSize = 4096;
+
+    // Abort on an invariant violation so that the fuzzer records the input.
+    void check( bool condition )
+    {
+        if ( !condition ) std::abort();
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size )
+{
+    // Hostile compressed block. A vector sized exactly exposes any write past the capacity given.
+    for ( const size_t capacity : { size_t( 65536 ), size ? size_t( pData[0] ) : size_t( 0 ) } )
+    {
+        std::vector< unsigned char > output( capacity );
+        const auto outputLen = LzBlockCodec::decompress( pData, size, output.data(), output.size() );
+        check( LzBlockCodec::errorSize == outputLen || capacity >= outputLen );
+    }
+
+    // Hostile archive.
+    {
+        ConstByteStreambuf archiveStreambuf{ pData, std::streamsize( size ) };
+        InputByteStream archiveStream{ &archiveStreambuf };
+        DecompressingByteStreambuf decompressingByteStreambuf{ archiveStream, maxBlockSize };
+        size_t total = 0;
+        while ( DecompressingByteStreambuf::traits_type::eof() != decompressingByteStreambuf.sbumpc() ) ++total;
+
+        // Every frame header of eight bytes yields at most one block.
+        check( total <= ( size / CompressedFrameFormat::headerSize ) * maxBlockSize );
+    }
+
+    // Block round trip.
+    std::vector< unsigned char > compressed( LzBlockCodec::compressBound( size ) );
+    const auto compressedLen = LzBlockCodec::compress( pData, size, compressed.data(), compressed.size() );
+    check( 0 != compressedLen && compressed.size() >= compressedLen );
+    std::vector< unsigned char > output( size );
+    check( size == LzBlockCodec::decompress( compressed.data(), compressedLen, output.data(), output.size() ) );
+    check( 0 == size || std::equal( output.begin(), output.end(), pData ) );
+
+    // Archive round trip, in blocks small enough that larger inputs span several.
+    std::vector< unsigned char > archive( 2 * size + 64 );
+    ByteStreambuf archiveOutStreambuf{ archive.data(), std::streamsize( archive.size() ), std::ios_base::out };
+    OutputByteStream archiveOutStream{ &archiveOutStreambuf };
+    {
+        CompressingByteStreambuf compressingByteStreambuf{ archiveOutStream, 256 };
+        check( std::streamsize( size ) == compressingByteStreambuf.sputn( pData, std::streamsize( size ) ) );
+        check( 0 == compressingByteStreambuf.pubsync() );
+    }
+    const auto archiveLen = archiveOutStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out );
+
+    ConstByteStreambuf archiveInStreambuf{ archive.data(), std::streamsize( archiveLen ) };
+    InputByteStream archiveInStream{ &archiveInStreambuf };
+    DecompressingByteStreambuf decompressingByteStreambuf{ archiveInStream, 256 };
+    check( std::streamsize( size ) == decompressingByteStreambuf.sgetn( output.data(), std::streamsize( size ) ) );
+    check( 0 == size || std::equal( output.begin(), output.end(), pData ) );
+    check( DecompressingByteStreambuf::traits_type::eof() == decompressingByteStreambuf.sgetc() &&
+           !decompressingByteStreambuf.corrupt() );
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+* @file fuzzRecordIndex.cpp
+* @brief Fuzz Target Exercising RecordIndexBuilder and RecordIndex Varint Paths
+*
+* The fuzz input is first opened directly as an index, which must either be rejected or be safely queryable.
+* It is then treated as length prefixed record data, indexed and the index is verified against a re-walk
+* of the records.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "RecordIndex.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    // Abort on an invariant violation so that the fuzzer records the input.
+    void check( bool condition )
+    {
+        if ( !condition ) std::abort();
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size )
+{
+    // Hostile index bytes.
+    try
+    {
+        RecordIndex recordIndex{ pData, size };
+        const uint64_t count = recordIndex.size();
+        const uint64_t probes[] = { 0, count / 2, count - 1, count };
+        for ( const auto n : probes )
+        {
+            try { recordIndex.offset( n ); }
+            catch ( const std::out_of_range & ) {}
+        }
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    // Hostile record data.
+    ConstByteStreambuf dataStreambuf{ pData, std::streamsize( size ) };
+    InputByteStream dataStream{ &dataStreambuf };
+    std::vector< unsigned char > indexBuffer( 2 * size + RecordIndexFormat::footerSize + 64 );
+    ByteStreambuf indexStreambuf{ indexBuffer.data(), std::streamsize( indexBuffer.size() ), std::ios::out };
+    OutputByteStream indexStream{ &indexStreambuf };
+    RecordIndexBuilder builder{ indexStream };
+    const auto numRecords = builder.addRecords( dataStream );
+    const auto indexLength = builder.finish();
+    check( 0 != indexLength );
+
+    RecordIndex recordIndex{ indexBuffer.data(), size_t( indexLength ) };
+    check( numRecords == recordIndex.size() );
+
+    // Re-walk the records and compare offsets.
+    dataStreambuf.pubseekpos( 0, std::ios_base::in );
+    for ( uint64_t n = 0; numRecords != n; ++n )
+    {
+        const auto offset = dataStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::in );
+        check( uint64_t( std::streamoff( offset ) ) == recordIndex.offset( n ) );
+        uint32_t recordLength = 0;
+        check( sizeof( recordLength ) == netToType( dataStreambuf, recordLength ) );
+        check( -1 != dataStreambuf.pubseekoff( recordLength, std::ios_base::cur, std::ios_base::in ) );
+    }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+* @file fuzzReplayMain.cpp
+* @brief Corpus Replay Driver for Fuzz Targets Built Without libFuzzer
+*
+* This driver links with a fuzz target in place of libFuzzer. It replays every input file found within
+* the directories (or files) named on the command line through LLVMFuzzerTestOneInput, reporting the
+* total and slowest input times. This lets the saved corpus serve as a regression test with any compiler and
+* as a benchmark input set. An input taking longer than the optional time budget is reported as a
+* performance regression and causes a non-zero exit code.
+*
+* Usage: fuzzReplay [--max-ms <milliseconds>] <corpus directory or file>...
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size );
+
+namespace
+{
+    void collectInputs( const std::string & path, std::vector< std::string > & inputs )
+    {
+        struct stat st;
+        if ( 0 != stat( path.c_str(), &st ) ) return;
+        if ( !S_ISDIR( st.st_mode ) )
+        {
+            inputs.push_back( path );
+            return;
+        }
+
+        DIR * pDir = opendir( path.c_str() );
+        if ( !pDir ) return;
+        while ( struct dirent * pEntry = readdir( pDir ) )
+        {
+            if ( '.' == pEntry->d_name[0] ) continue;
+            collectInputs( path + "/" + pEntry->d_name, inputs );
+        }
+        closedir( pDir );
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    double maxMilliseconds = 0.0;
+    std::vector< std::string > inputs;
+    for ( int i = 1; argc != i; ++i )
+    {
+        if ( 0 == strcmp( "--max-ms", argv[i] ) && argc != i + 1 )
+            maxMilliseconds = std::atof( argv[++i] );
+        else
+            collectInputs( argv[i], inputs );
+    }
+
+    if ( inputs.empty() )
+    {
+        std::cout << "No corpus inputs found!" << std::endl;
+        return 1;
+    }
+
+    int retCode = 0;
+    double totalMilliseconds = 0.0;
+    double slowestMilliseconds = 0.0;
+    std::string slowestInput;
+    size_t totalBytes = 0;
+    for ( const auto & input : inputs )
+    {
+        std::ifstream file( input, std::ios::binary );
+        const std::vector< char > bytes{ std::istreambuf_iterator< char >( file ), std::istreambuf_iterator< char >() };
+        totalBytes += bytes.size();
+
+        const auto start = std::chrono::steady_clock::now();
+        LLVMFuzzerTestOneInput( reinterpret_cast< const uint8_t * >( bytes.data() ), bytes.size() );
+        const std::chrono::duration< double, std::milli > elapsed = std::chrono::steady_clock::now() - start;
+
+        totalMilliseconds += elapsed.count();
+        if ( elapsed.count() > slowestMilliseconds )
+        {
+            slowestMilliseconds = elapsed.count();
+            slowestInput = input;
+        }
+        if ( 0.0 < maxMilliseconds && elapsed.count() > maxMilliseconds )
+        {
+            std::cout << "Performance regression: " << input << " took " << elapsed.count()
+                      << " ms, budget is " << maxMilliseconds << " ms" << std::endl;
+            retCode = 2;
+        }
+    }
+
+    std::cout << "Replayed " << inputs.size() << " inputs (" << totalBytes << " bytes) in "
+              << totalMilliseconds << " ms. Slowest: " << slowestInput << " at " << slowestMilliseconds
+              << " ms" << std::endl;
+
+    return retCode;
+}
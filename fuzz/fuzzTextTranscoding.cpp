@@ -0,0 +1,102 @@
+/**
+* @file fuzzTextTranscoding.cpp
+* @brief Fuzz Target Exercising Hex and Base64 Decoding of Hostile Text
+*
+* The fuzz input is first decoded as hostile hex and base64 text, directly and from the get area of a stream
+* buffer, into output sized exactly and one byte short. Decoding must either be rejected, leaving the put position
+* where it was, or produce bytes which encode and decode back to themselves. The input is then encoded both ways
+* and must decode to itself.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "TextTranscoding.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    using Decode = size_t ( * )( const unsigned char *, size_t, ByteStreambuf & );
+    using DecodeReadable = size_t ( * )( ByteStreambuf &, ByteStreambuf & );
+    using Encode = size_t ( * )( const unsigned char *, size_t, ByteStreambuf & );
+
+    // Abort on an invariant violation so that the fuzzer records the input.
+    void check( bool condition )
+    {
+        if ( !condition ) std::abort();
+    }
+
+    // Decodes hostile text into output of a given capacity, checking the result whichever way it goes.
+    void decodeHostile( const uint8_t * pData, size_t size, size_t capacity, Decode decode,
+                        DecodeReadable decodeReadable, Encode encode, size_t ( * encodedSize )( size_t ) )
+    {
+        std::vector< unsigned char > output( capacity );
+        ByteStreambuf outStreambuf{ output.data(), std::streamsize( output.size() ), std::ios_base::out };
+        const size_t len = decode( pData, size, outStreambuf );
+        check( capacity >= len );
+        check( output.data() + len == outStreambuf.position().pPut );
+
+        // The same text read from a get area must decode the same way, consuming it only when decoded.
+        std::vector< unsigned char > readableOutput( capacity );
+        ByteStreambuf readableOutStreambuf{ readableOutput.data(), std::streamsize( readableOutput.size() ),
+                                            std::ios_base::out };
+        ConstByteStreambuf inStreambuf{ pData, std::streamsize( size ) };
+        check( len == decodeReadable( inStreambuf, readableOutStreambuf ) );
+        check( std::equal( output.begin(), output.begin() + std::ptrdiff_t( len ), readableOutput.begin() ) );
+        check( ( 0 == len ? pData : pData + size ) == inStreambuf.position().pGet );
+        if ( 0 == len ) return;
+
+        // Decoded bytes re-encode to text which decodes back to them.
+        std::vector< unsigned char > text( encodedSize( len ) );
+        ByteStreambuf textStreambuf{ text.data(), std::streamsize( text.size() ), std::ios_base::out };
+        check( text.size() == encode( output.data(), len, textStreambuf ) );
+        std::vector< unsigned char > again( len );
+        ByteStreambuf againStreambuf{ again.data(), std::streamsize( again.size() ), std::ios_base::out };
+        check( len == decode( text.data(), text.size(), againStreambuf ) );
+        check( std::equal( again.begin(), again.end(), output.begin() ) );
+    }
+
+    size_t hexEncodedSize( size_t len ) { return TextTranscoding::hexEncodedSize( len ); }
+    size_t base64EncodedSize( size_t len ) { return TextTranscoding::base64EncodedSize( len ); }
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t * pData, size_t size )
+{
+    // Hostile text, into output sized for it and one byte short.
+    const size_t hexCapacity = size / 2;
+    for ( const size_t capacity : { hexCapacity, std::max( hexCapacity, size_t( 1 ) ) - 1 } )
+        decodeHostile( pData, size, capacity, &TextTranscoding::hexDecode, &TextTranscoding::hexDecodeReadable,
+                       &TextTranscoding::hexEncode, &hexEncodedSize );
+    const size_t base64Capacity = size / 4 * 3;
+    for ( const size_t capacity : { base64Capacity, std::max( base64Capacity, size_t( 1 ) ) - 1 } )
+        decodeHostile( pData, size, capacity, &TextTranscoding::base64Decode, &TextTranscoding::base64DecodeReadable,
+                       &TextTranscoding::base64Encode, &base64EncodedSize );
+
+    // Round trips of the input as bytes.
+    const std::pair< Encode, Decode > codecs[] = {
+        { &TextTranscoding::hexEncode, &TextTranscoding::hexDecode },
+        { &TextTranscoding::base64Encode, &TextTranscoding::base64Decode } };
+    for ( const auto & codec : codecs )
+    {
+        std::vector< unsigned char > text( TextTranscoding::hexEncodedSize( size ) + 4 );
+        ByteStreambuf textStreambuf{ text.data(), std::streamsize( text.size() ), std::ios_base::out };
+        const size_t textLen = codec.first( pData, size, textStreambuf );
+        check( 0 != textLen || 0 == size );
+
+        std::vector< unsigned char > output( size );
+        ByteStreambuf outStreambuf{ output.data(), std::streamsize( output.size() ), std::ios_base::out };
+        check( size == codec.second( text.data(), textLen, outStreambuf ) );
+        check( 0 == size || std::equal( output.begin(), output.end(), pData ) );
+    }
+
+    return 0;
+}
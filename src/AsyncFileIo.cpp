@@ -0,0 +1,335 @@
+/**
+* @file AsyncFileIo.cpp
+* @brief The Implementation for the Asynchronous File I/O Engine Shared by AsyncFileSink and AsyncFileSource
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "AsyncFileIo.h"
+
+// io_uring is Linux only. Elsewhere, the thread pool is always used.
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <system_error>
+#include <cerrno>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+constexpr size_t AsyncFileIo::directAlignment;
+
+namespace
+{
+    constexpr unsigned maxWorkers = 4;
+
+#ifdef __linux__
+    // The most io_uring transfers in one request, as Linux caps a read or write. It is aligned for O_DIRECT.
+    constexpr size_t maxRingTransfer = 0x7FFFF000;
+
+    int ioUringSetup( unsigned entries, io_uring_params * pParams )
+    {
+        return int( syscall( __NR_io_uring_setup, entries, pParams ) );
+    }
+
+    int ioUringEnter( int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags )
+    {
+        return int( syscall( __NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0 ) );
+    }
+
+    int ioUringRegister( int ringFd, unsigned opcode, const void * pArg, unsigned count )
+    {
+        return int( syscall( __NR_io_uring_register, ringFd, opcode, pArg, count ) );
+    }
+
+    void * ringPointer( void * pRing, unsigned offset )
+    {
+        return static_cast< unsigned char * >( pRing ) + offset;
+    }
+#endif
+}
+
+AsyncFileIo::AsyncFileIo( const char * path, bool forWriting, bool directIo, unsigned depth, AsyncIoBackend backend )
+  : _forWriting( forWriting )
+{
+    const int flags = forWriting ? ( O_WRONLY | O_CREAT | O_TRUNC ) : O_RDONLY;
+    _fd = open( path, flags | O_CLOEXEC, 0644 );
+    if ( 0 > _fd ) throw std::system_error( errno, std::generic_category(), path );
+
+    // Not every platform or file system supports O_DIRECT. We quietly do without it on those that do not.
+#ifdef O_DIRECT
+    if ( directIo )
+        _directFd = open( path, ( forWriting ? O_WRONLY : O_RDONLY ) | O_DIRECT | O_CLOEXEC );
+#else
+    (void)directIo;
+#endif
+
+    if ( 0 == depth ) depth = 1;
+    if ( AsyncIoBackend::automatic == backend && _setupRing( depth ) ) return;
+
+    const unsigned numWorkers = depth < maxWorkers ? depth : maxWorkers;
+    for ( unsigned i = 0; numWorkers != i; ++i )
+        _workers.emplace_back( &AsyncFileIo::_worker, this );
+}
+
+AsyncFileIo::~AsyncFileIo()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _workReady.notify_all();
+    for ( auto & worker : _workers )
+        worker.join();
+
+    _teardownRing();
+    if ( 0 <= _directFd ) close( _directFd );
+    close( _fd );
+}
+
+bool AsyncFileIo::registerBuffers( const struct iovec * pIovecs, unsigned count )
+{
+#ifdef __linux__
+    if ( 0 > _ringFd ) return false;
+    _buffersRegistered = 0 == ioUringRegister( _ringFd, IORING_REGISTER_BUFFERS, pIovecs, count );
+    return _buffersRegistered;
+#else
+    (void)pIovecs;
+    (void)count;
+    return false;
+#endif
+}
+
+void AsyncFileIo::submit( unsigned char * pBuf, size_t len, uint64_t offset, int bufIndex, uint64_t tag )
+{
+#ifdef __linux__
+    // A longer request could not be described by an entry. It completes short, as any may.
+    if ( 0 <= _ringFd && maxRingTransfer < len ) len = maxRingTransfer;
+#else
+    (void)bufIndex;
+#endif
+    const int fd = _fdFor( pBuf, len, offset );
+
+    if ( 0 > _ringFd )
+    {
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _requests.push_back( Request{ fd, pBuf, len, offset, tag } );
+        }
+        _workReady.notify_one();
+        return;
+    }
+
+#ifdef __linux__
+    // We are the only producer, so the tail is ours to read without ordering. The kernel's consumption of the
+    // entry is ordered by the release store of the new tail.
+    const unsigned tail = *_pSqTail;
+    const unsigned index = tail & *_pSqMask;
+    io_uring_sqe * pSqe = &_pSqes[ index ];
+    memset( pSqe, 0, sizeof( *pSqe ) );
+    const bool fixed = _buffersRegistered && 0 <= bufIndex;
+    if ( _forWriting ) pSqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    else pSqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    pSqe->fd = fd;
+    pSqe->addr = uint64_t( reinterpret_cast< uintptr_t >( pBuf ) );
+    pSqe->len = unsigned( len );
+    pSqe->off = offset;
+    pSqe->buf_index = fixed ? uint16_t( bufIndex ) : 0;
+    pSqe->user_data = tag;
+    _pSqArray[ index ] = index;
+    __atomic_store_n( _pSqTail, tail + 1, __ATOMIC_RELEASE );
+
+    int ret;
+    do {
+        ret = ioUringEnter( _ringFd, 1, 0, 0 );
+    } while ( 0 > ret && EINTR == errno );
+
+    if ( 1 == ret ) return;
+
+    // Should the kernel refuse the entry, report it as a failed completion. The kernel consumes entries only
+    // within io_uring_enter, as we do not use a polling thread, so an entry it has not consumed may be withdrawn.
+    // One it has consumed will complete with its own result, which must be the only completion for the tag.
+    const int error = 0 > ret ? errno : EAGAIN;
+    if ( tail + 1 == __atomic_load_n( _pSqHead, __ATOMIC_ACQUIRE ) ) return;
+    __atomic_store_n( _pSqTail, tail, __ATOMIC_RELEASE );
+    std::lock_guard< std::mutex > lock( _mutex );
+    _completions.push_back( AsyncFileIoCompletion{ tag, -long( error ) } );
+#endif
+}
+
+bool AsyncFileIo::wait( AsyncFileIoCompletion & completion, bool block )
+{
+    if ( 0 > _ringFd )
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        if ( block )
+            _completionReady.wait( lock, [ this ]{ return !_completions.empty(); } );
+        if ( _completions.empty() ) return false;
+        completion = _completions.front();
+        _completions.pop_front();
+        return true;
+    }
+
+#ifdef __linux__
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if ( !_completions.empty() )
+        {
+            completion = _completions.front();
+            _completions.pop_front();
+            return true;
+        }
+    }
+
+    for (;;)
+    {
+        const unsigned head = *_pCqHead;
+        if ( head != __atomic_load_n( _pCqTail, __ATOMIC_ACQUIRE ) )
+        {
+            const io_uring_cqe & cqe = _pCqes[ head & *_pCqMask ];
+            completion = AsyncFileIoCompletion{ cqe.user_data, long( cqe.res ) };
+            __atomic_store_n( _pCqHead, head + 1, __ATOMIC_RELEASE );
+            return true;
+        }
+        if ( !block ) return false;
+
+        const int ret = ioUringEnter( _ringFd, 0, 1, IORING_ENTER_GETEVENTS );
+        if ( 0 > ret && EINTR != errno ) throw std::system_error( errno, std::generic_category(), "io_uring_enter" );
+    }
+#else
+    return false;
+#endif
+}
+
+bool AsyncFileIo::_setupRing( unsigned depth )
+{
+#ifdef __linux__
+    io_uring_params params;
+    memset( &params, 0, sizeof( params ) );
+    _ringFd = ioUringSetup( depth, &params );
+    if ( 0 > _ringFd ) return false;
+
+    // We rely upon the plain read and write operations, which arrived alongside this feature.
+    if ( !( params.features & IORING_FEAT_RW_CUR_POS ) )
+    {
+        _teardownRing();
+        return false;
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof( io_uring_cqe );
+    const bool singleMmap = 0 != ( params.features & IORING_FEAT_SINGLE_MMAP );
+    if ( singleMmap && _cqRingSize > _sqRingSize ) _sqRingSize = _cqRingSize;
+
+    _pSqRing = mmap( nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     _ringFd, IORING_OFF_SQ_RING );
+    if ( MAP_FAILED == _pSqRing )
+    {
+        _pSqRing = nullptr;
+        _teardownRing();
+        return false;
+    }
+
+    if ( singleMmap ) _pCqRing = _pSqRing;
+    else
+    {
+        _pCqRing = mmap( nullptr, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         _ringFd, IORING_OFF_CQ_RING );
+        if ( MAP_FAILED == _pCqRing )
+        {
+            _pCqRing = nullptr;
+            _teardownRing();
+            return false;
+        }
+    }
+
+    _sqesSize = params.sq_entries * sizeof( io_uring_sqe );
+    void * pSqes = mmap( nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         _ringFd, IORING_OFF_SQES );
+    if ( MAP_FAILED == pSqes )
+    {
+        _teardownRing();
+        return false;
+    }
+    _pSqes = static_cast< io_uring_sqe * >( pSqes );
+
+    _pSqHead = static_cast< unsigned * >( ringPointer( _pSqRing, params.sq_off.head ) );
+    _pSqTail = static_cast< unsigned * >( ringPointer( _pSqRing, params.sq_off.tail ) );
+    _pSqMask = static_cast< unsigned * >( ringPointer( _pSqRing, params.sq_off.ring_mask ) );
+    _pSqArray = static_cast< unsigned * >( ringPointer( _pSqRing, params.sq_off.array ) );
+    _pCqHead = static_cast< unsigned * >( ringPointer( _pCqRing, params.cq_off.head ) );
+    _pCqTail = static_cast< unsigned * >( ringPointer( _pCqRing, params.cq_off.tail ) );
+    _pCqMask = static_cast< unsigned * >( ringPointer( _pCqRing, params.cq_off.ring_mask ) );
+    _pCqes = static_cast< io_uring_cqe * >( ringPointer( _pCqRing, params.cq_off.cqes ) );
+    return true;
+#else
+    (void)depth;
+    return false;
+#endif
+}
+
+void AsyncFileIo::_teardownRing()
+{
+#ifdef __linux__
+    if ( _pSqes ) munmap( _pSqes, _sqesSize );
+    if ( _pCqRing && _pCqRing != _pSqRing ) munmap( _pCqRing, _cqRingSize );
+    if ( _pSqRing ) munmap( _pSqRing, _sqRingSize );
+    _pSqes = nullptr;
+    _pCqRing = nullptr;
+    _pSqRing = nullptr;
+
+    if ( 0 <= _ringFd ) close( _ringFd );
+    _ringFd = -1;
+#endif
+}
+
+void AsyncFileIo::_worker()
+{
+    for (;;)
+    {
+        Request request;
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            _workReady.wait( lock, [ this ]{ return _stopping || !_requests.empty(); } );
+            if ( _requests.empty() ) return;
+            request = _requests.front();
+            _requests.pop_front();
+        }
+
+        // Unlike io_uring, we transfer the whole request, stopping short only at end of file.
+        long result = 0;
+        while ( size_t( result ) < request.len )
+        {
+            const ssize_t ret = _forWriting ?
+                pwrite( request.fd, request.pBuf + result, request.len - size_t( result ), off_t( request.offset + uint64_t( result ) ) ) :
+                pread( request.fd, request.pBuf + result, request.len - size_t( result ), off_t( request.offset + uint64_t( result ) ) );
+            if ( 0 > ret )
+            {
+                if ( EINTR == errno ) continue;
+                result = -long( errno );
+                break;
+            }
+            if ( 0 == ret ) break;
+            result += long( ret );
+        }
+
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _completions.push_back( AsyncFileIoCompletion{ request.tag, result } );
+        }
+        _completionReady.notify_one();
+    }
+}
+
+int AsyncFileIo::_fdFor( const unsigned char * pBuf, size_t len, uint64_t offset ) const
+{
+    if ( 0 > _directFd ) return _fd;
+    const bool aligned = 0 == ( reinterpret_cast< uintptr_t >( pBuf ) | len | offset ) % directAlignment;
+    return aligned ? _directFd : _fd;
+}
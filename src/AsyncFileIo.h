@@ -0,0 +1,182 @@
+/**
+* @file AsyncFileIo.h
+* @brief The Specification for the Asynchronous File I/O Engine Shared by AsyncFileSink and AsyncFileSource
+*
+* This is a private header. It is not installed.
+*
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_ASYNCFILEIO_H
+#define REISERRT_BYTESTREAMBUF_ASYNCFILEIO_H
+
+#include "AsyncIoBackend.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+struct iovec;
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Asynchronous File I/O Completion
+        */
+        struct AsyncFileIoCompletion
+        {
+            uint64_t tag;       //!< The tag of the request completed.
+            long result;        //!< The number of bytes transferred, or a negated errno value.
+        };
+
+        /**
+        * @brief Asynchronous File I/O Engine
+        *
+        * This class owns an open file and performs positioned reads or writes upon it asynchronously.
+        * It uses io_uring by way of raw system calls on Linux when the kernel affords it, and a small pool of
+        * threads performing pread and pwrite otherwise. No more than the depth specified may be outstanding.
+        *
+        * When direct I/O is requested, the file is also opened with O_DIRECT. Requests whose offset, length and
+        * address are all aligned to directAlignment use that descriptor. All others use the buffered descriptor,
+        * so that a stream of arbitrarily sized blocks may still be written and read contiguously.
+        *
+        * Requests are submitted and completions waited upon from a single thread.
+        */
+        class AsyncFileIo
+        {
+        public:
+            static constexpr size_t directAlignment = 4096;    //!< The alignment O_DIRECT transfers require.
+
+            /**
+            * @brief Constructor for AsyncFileIo
+            *
+            * @param path The path of the file to open.
+            * @param forWriting If true, the file is created or truncated for writing. Otherwise, it is opened for reading.
+            * @param directIo If true, O_DIRECT is used where the file system and request alignment permit.
+            * @param depth The greatest number of requests which may be outstanding.
+            * @param backend The backend selection.
+            * @throw Throws std::system_error if the file cannot be opened.
+            */
+            AsyncFileIo( const char * path, bool forWriting, bool directIo, unsigned depth, AsyncIoBackend backend );
+
+            /**
+            * @brief Destructor for AsyncFileIo
+            *
+            * The client must have waited for every outstanding request. Stops any threads and closes the file.
+            */
+            ~AsyncFileIo();
+
+            AsyncFileIo( const AsyncFileIo & ) = delete;
+            AsyncFileIo & operator=( const AsyncFileIo & ) = delete;
+
+            /**
+            * @brief Register Buffers
+            *
+            * Registers buffers with io_uring so that requests naming them avoid per request page pinning.
+            * This is a no operation for the thread pool, and may fail, for instance due to the locked memory limit.
+            *
+            * @param pIovecs The buffers.
+            * @param count The number of buffers.
+            * @return Returns true if the buffers were registered.
+            */
+            bool registerBuffers( const struct iovec * pIovecs, unsigned count );
+
+            /**
+            * @brief Submit a Request
+            *
+            * The request may complete short. With io_uring, no more than 2^31 - 4096 bytes are transferred by one
+            * request. The client submits the remainder.
+            *
+            * @param pBuf The buffer to read into or write from.
+            * @param len The number of bytes to transfer.
+            * @param offset The file offset.
+            * @param bufIndex The index of the registered buffer holding pBuf, or -1 if none.
+            * @param tag A value returned with the completion.
+            */
+            void submit( unsigned char * pBuf, size_t len, uint64_t offset, int bufIndex, uint64_t tag );
+
+            /**
+            * @brief Wait for a Completion
+            *
+            * @param completion The completion.
+            * @param block If true, waits for a completion when none is ready.
+            * @return Returns true if a completion was returned.
+            * @throw Throws std::system_error if waiting upon io_uring fails.
+            */
+            bool wait( AsyncFileIoCompletion & completion, bool block );
+
+            /**
+            * @brief io_uring Query
+            *
+            * @return Returns true if io_uring is in use.
+            */
+            bool usingIoUring() const { return 0 <= _ringFd; }
+
+            /**
+            * @brief Direct I/O Query
+            *
+            * @return Returns true if the file was opened with O_DIRECT.
+            */
+            bool usingDirectIo() const { return 0 <= _directFd; }
+
+        private:
+            bool _setupRing( unsigned depth );
+            void _teardownRing();
+            void _worker();
+            int _fdFor( const unsigned char * pBuf, size_t len, uint64_t offset ) const;
+
+            struct Request
+            {
+                int fd;
+                unsigned char * pBuf;
+                size_t len;
+                uint64_t offset;
+                uint64_t tag;
+            };
+
+            const bool _forWriting;
+            int _fd{ -1 };
+            int _directFd{ -1 };
+
+            // io_uring state. The descriptor alone exists elsewhere, where it is never valid.
+            int _ringFd{ -1 };
+#ifdef __linux__
+            bool _buffersRegistered{ false };
+            void * _pSqRing{ nullptr };
+            size_t _sqRingSize{ 0 };
+            void * _pCqRing{ nullptr };
+            size_t _cqRingSize{ 0 };
+            io_uring_sqe * _pSqes{ nullptr };
+            size_t _sqesSize{ 0 };
+            unsigned * _pSqHead{ nullptr };
+            unsigned * _pSqTail{ nullptr };
+            unsigned * _pSqMask{ nullptr };
+            unsigned * _pSqArray{ nullptr };
+            unsigned * _pCqHead{ nullptr };
+            unsigned * _pCqTail{ nullptr };
+            unsigned * _pCqMask{ nullptr };
+            io_uring_cqe * _pCqes{ nullptr };
+#endif
+
+            // Thread pool state. Completions of failed submissions are also queued here.
+            std::mutex _mutex;
+            std::condition_variable _workReady;
+            std::condition_variable _completionReady;
+            std::deque< Request > _requests;
+            std::deque< AsyncFileIoCompletion > _completions;
+            std::vector< std::thread > _workers;
+            bool _stopping{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_ASYNCFILEIO_H
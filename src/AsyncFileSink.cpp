@@ -0,0 +1,140 @@
+/**
+* @file AsyncFileSink.cpp
+* @brief The Implementation for an Asynchronous File Sink of Filled ByteStreambuf Blocks
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "AsyncFileSink.h"
+#include "AsyncFileIo.h"
+
+#include <sys/uio.h>
+
+#include <stdexcept>
+#include <cerrno>
+#include <cstdlib>
+
+using namespace ReiserRT::Utility;
+
+AsyncFileSink::AsyncFileSink( const char * path, size_t blockSize, unsigned numBlocks,
+                              bool directIo, AsyncIoBackend backend )
+  : _pIo( new AsyncFileIo( path, true, directIo, 0 == numBlocks ? 1 : numBlocks, backend ) )
+  , _blockSize( 0 == blockSize ? 1 : blockSize )
+{
+    if ( 0 == numBlocks ) numBlocks = 1;
+    _blocks.reserve( numBlocks );
+    _freeList.reserve( numBlocks );
+
+    std::vector< iovec > iovecs;
+    for ( unsigned i = 0; numBlocks != i; ++i )
+    {
+        // Page alignment satisfies O_DIRECT.
+        void * pMem = nullptr;
+        if ( 0 != posix_memalign( &pMem, AsyncFileIo::directAlignment, _blockSize ) )
+        {
+            _freeBlocks();
+            throw std::system_error( ENOMEM, std::generic_category(), "AsyncFileSink" );
+        }
+        auto pBuf = static_cast< unsigned char * >( pMem );
+        _blocks.push_back( Block{ pBuf, std::unique_ptr< ByteStreambuf >(), 0, 0, 0 } );
+        _blocks.back().pStreambuf.reset( new ByteStreambuf( pBuf, std::streamsize( _blockSize ), std::ios_base::out ) );
+        _freeList.push_back( numBlocks - 1 - i );
+        iovecs.push_back( iovec{ pBuf, _blockSize } );
+    }
+
+    _pIo->registerBuffers( iovecs.data(), unsigned( iovecs.size() ) );
+}
+
+AsyncFileSink::~AsyncFileSink()
+{
+    try {
+        while ( _inFlight ) _reap( true );
+    }
+    catch ( ... ) {
+        // The kernel may yet write from the blocks, so we must not free them.
+        return;
+    }
+    _freeBlocks();
+}
+
+ByteStreambuf & AsyncFileSink::acquire()
+{
+    // Reap whatever has completed, waiting only if no block is free.
+    while ( _inFlight && _reap( false ) ) {}
+    while ( _freeList.empty() ) _reap( true );
+
+    Block & block = _blocks[ _freeList.back() ];
+    _freeList.pop_back();
+    block.pStreambuf->pubsetbuf( block.pBuf, std::streamsize( _blockSize ) );
+    return *block.pStreambuf;
+}
+
+void AsyncFileSink::submit( ByteStreambuf & block )
+{
+    unsigned index = 0;
+    while ( _blocks.size() != index && _blocks[ index ].pStreambuf.get() != &block ) ++index;
+    if ( _blocks.size() == index )
+        throw std::invalid_argument( "AsyncFileSink::submit: block not acquired from this sink" );
+
+    Block & b = _blocks[ index ];
+    b.len = size_t( block.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) );
+    if ( 0 == b.len )
+    {
+        _freeList.push_back( index );
+        return;
+    }
+
+    b.done = 0;
+    b.offset = _nextOffset;
+    _nextOffset += b.len;
+    ++_inFlight;
+    _pIo->submit( b.pBuf, b.len, b.offset, int( index ), index );
+}
+
+void AsyncFileSink::flush()
+{
+    while ( _inFlight ) _reap( true );
+    if ( _error ) throw std::system_error( _error, "AsyncFileSink" );
+}
+
+bool AsyncFileSink::usingIoUring() const
+{
+    return _pIo->usingIoUring();
+}
+
+bool AsyncFileSink::usingDirectIo() const
+{
+    return _pIo->usingDirectIo();
+}
+
+bool AsyncFileSink::_reap( bool block )
+{
+    AsyncFileIoCompletion completion;
+    if ( !_pIo->wait( completion, block ) ) return false;
+
+    const unsigned index = unsigned( completion.tag );
+    Block & b = _blocks[ index ];
+    if ( 0 < completion.result )
+    {
+        // Writes may complete short. Submit the remainder.
+        b.done += size_t( completion.result );
+        if ( b.done < b.len )
+        {
+            _pIo->submit( b.pBuf + b.done, b.len - b.done, b.offset + b.done, int( index ), index );
+            return true;
+        }
+    }
+    else if ( !_error )
+        _error = std::error_code( 0 == completion.result ? EIO : int( -completion.result ), std::generic_category() );
+
+    --_inFlight;
+    _freeList.push_back( index );
+    return true;
+}
+
+void AsyncFileSink::_freeBlocks()
+{
+    for ( auto & block : _blocks )
+        free( block.pBuf );
+    _blocks.clear();
+}
@@ -0,0 +1,149 @@
+/**
+* @file AsyncFileSink.h
+* @brief The Specification for an Asynchronous File Sink of Filled ByteStreambuf Blocks
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_ASYNCFILESINK_H
+#define REISERRT_BYTESTREAMBUF_ASYNCFILESINK_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "AsyncIoBackend.h"
+#include "ByteStreambuf.h"
+
+#include <memory>
+#include <system_error>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        class AsyncFileIo;
+
+        /**
+        * @brief Asynchronous File Sink of Filled ByteStreambuf Blocks
+        *
+        * This class affords a recorder a way to write ByteStreambuf blocks to a file without blocking upon write.
+        * It owns a fixed set of page aligned blocks, each with its own ByteStreambuf. A block is acquired, serialized
+        * into, and submitted. The bytes between the start of the put area and the put position are then written
+        * at the next file offset asynchronously, and the block returns to a free list upon completion.
+        * Acquiring a block waits only when every block is in flight.
+        *
+        * io_uring is used when the kernel affords it, with the blocks registered as fixed buffers where the locked
+        * memory limit permits. Otherwise a small thread pool performs the writes. With direct I/O requested, blocks
+        * whose length is a multiple of 4096 bytes are written with O_DIRECT, bypassing the page cache.
+        *
+        * An instance is to be used from a single thread.
+        *
+        * @code AsyncFileSink sink( "capture.bin" );
+        * @code ByteStreambuf & block = sink.acquire();
+        * @code typeToNet( value, block );
+        * @code sink.submit( block );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT AsyncFileSink
+        {
+        public:
+            /**
+            * @brief Constructor for AsyncFileSink
+            *
+            * @param path The path of the file to create or truncate.
+            * @param blockSize The capacity of each block. It must not exceed 2^31 - 1 bytes.
+            * @param numBlocks The number of blocks, bounding the writes in flight.
+            * @param directIo If true, O_DIRECT is used where the file system and block length permit.
+            * @param backend The backend selection.
+            * @throw Throws std::system_error if the file cannot be opened or memory allocated.
+            */
+            explicit AsyncFileSink( const char * path, size_t blockSize = 1048576, unsigned numBlocks = 4,
+                                    bool directIo = false, AsyncIoBackend backend = AsyncIoBackend::automatic );
+
+            /**
+            * @brief Destructor for AsyncFileSink
+            *
+            * Waits for every submitted block to be written. Errors are not reported. Invoke flush to learn of them.
+            */
+            ~AsyncFileSink();
+
+            AsyncFileSink( const AsyncFileSink & ) = delete;
+            AsyncFileSink & operator=( const AsyncFileSink & ) = delete;
+
+            /**
+            * @brief Acquire a Block
+            *
+            * Waits for a block to become free if none are. The block's put area spans its whole capacity.
+            *
+            * @return Returns the ByteStreambuf of the block, opened for output.
+            * @throw Throws std::system_error if waiting upon the I/O backend fails.
+            */
+            ByteStreambuf & acquire();
+
+            /**
+            * @brief Submit a Block
+            *
+            * Writes the bytes put into the block at the next file offset. A block with nothing put is simply freed.
+            *
+            * @param block A ByteStreambuf returned by acquire.
+            * @throw Throws std::invalid_argument if the block was not acquired from this sink.
+            */
+            void submit( ByteStreambuf & block );
+
+            /**
+            * @brief Flush Submitted Blocks
+            *
+            * Waits for every submitted block to be written.
+            *
+            * @throw Throws std::system_error if any write has failed.
+            */
+            void flush();
+
+            /**
+            * @brief Bytes Submitted
+            *
+            * @return Returns the number of bytes submitted, which is the file length once flushed.
+            */
+            uint64_t bytesSubmitted() const { return _nextOffset; }
+
+            /**
+            * @brief io_uring Query
+            *
+            * @return Returns true if io_uring is in use.
+            */
+            bool usingIoUring() const;
+
+            /**
+            * @brief Direct I/O Query
+            *
+            * @return Returns true if the file was opened with O_DIRECT.
+            */
+            bool usingDirectIo() const;
+
+        private:
+            struct Block
+            {
+                unsigned char * pBuf;
+                std::unique_ptr< ByteStreambuf > pStreambuf;
+                size_t len;
+                size_t done;
+                uint64_t offset;
+            };
+
+            bool _reap( bool block );
+            void _freeBlocks();
+
+            std::unique_ptr< AsyncFileIo > _pIo;
+            std::vector< Block > _blocks;
+            std::vector< unsigned > _freeList;
+            const size_t _blockSize;
+            unsigned _inFlight{ 0 };
+            uint64_t _nextOffset{ 0 };
+            std::error_code _error;
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_ASYNCFILESINK_H
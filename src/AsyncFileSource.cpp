@@ -0,0 +1,142 @@
+/**
+* @file AsyncFileSource.cpp
+* @brief The Implementation for an Asynchronous Read Ahead File Source of ByteStreambuf Blocks
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "AsyncFileSource.h"
+#include "AsyncFileIo.h"
+
+#include <sys/uio.h>
+
+#include <cerrno>
+#include <cstdlib>
+
+using namespace ReiserRT::Utility;
+
+AsyncFileSource::AsyncFileSource( const char * path, size_t blockSize, unsigned readAhead,
+                                  bool directIo, AsyncIoBackend backend )
+  : _pIo( new AsyncFileIo( path, false, directIo, readAhead + 1, backend ) )
+  , _blockSize( 0 == blockSize ? 1 : blockSize )
+{
+    // One block more than the read ahead is held by the client.
+    const unsigned numBlocks = readAhead + 1;
+    _blocks.reserve( numBlocks );
+
+    std::vector< iovec > iovecs;
+    for ( unsigned i = 0; numBlocks != i; ++i )
+    {
+        // Page alignment satisfies O_DIRECT.
+        void * pMem = nullptr;
+        if ( 0 != posix_memalign( &pMem, AsyncFileIo::directAlignment, _blockSize ) )
+        {
+            _freeBlocks();
+            throw std::system_error( ENOMEM, std::generic_category(), "AsyncFileSource" );
+        }
+        auto pBuf = static_cast< unsigned char * >( pMem );
+        _blocks.push_back( Block{ pBuf, std::unique_ptr< ByteStreambuf >(), 0, 0, false, 0 } );
+        _blocks.back().pStreambuf.reset( new ByteStreambuf( pBuf, 0, std::ios_base::in ) );
+        iovecs.push_back( iovec{ pBuf, _blockSize } );
+    }
+
+    _pIo->registerBuffers( iovecs.data(), unsigned( iovecs.size() ) );
+
+    for ( unsigned i = 0; numBlocks != i; ++i )
+        _submit( i );
+}
+
+AsyncFileSource::~AsyncFileSource()
+{
+    try {
+        while ( _inFlight ) _reap( true );
+    }
+    catch ( ... ) {
+        // The kernel may yet read into the blocks, so we must not free them.
+        return;
+    }
+    _freeBlocks();
+}
+
+ByteStreambuf * AsyncFileSource::next()
+{
+    const unsigned numBlocks = unsigned( _blocks.size() );
+
+    // Release the block previously returned, reading ahead with it.
+    if ( _held )
+    {
+        _held = false;
+        if ( !_endOfFile ) _submit( ( _nextIndex + numBlocks - 1 ) % numBlocks );
+    }
+
+    Block & b = _blocks[ _nextIndex ];
+    while ( b.inFlight ) _reap( true );
+    if ( b.error ) throw std::system_error( b.error, std::generic_category(), "AsyncFileSource" );
+    if ( 0 == b.done )
+    {
+        _endOfFile = true;
+        return nullptr;
+    }
+
+    // Only the final block is short.
+    if ( _blockSize > b.done ) _endOfFile = true;
+
+    b.pStreambuf->pubsetbuf( b.pBuf, std::streamsize( b.done ) );
+    _nextIndex = ( _nextIndex + 1 ) % numBlocks;
+    _held = true;
+    return b.pStreambuf.get();
+}
+
+bool AsyncFileSource::usingIoUring() const
+{
+    return _pIo->usingIoUring();
+}
+
+bool AsyncFileSource::usingDirectIo() const
+{
+    return _pIo->usingDirectIo();
+}
+
+void AsyncFileSource::_submit( unsigned index )
+{
+    Block & b = _blocks[ index ];
+    b.done = 0;
+    b.offset = _nextOffset;
+    b.inFlight = true;
+    b.error = 0;
+    _nextOffset += _blockSize;
+    ++_inFlight;
+    _pIo->submit( b.pBuf, _blockSize, b.offset, int( index ), index );
+}
+
+bool AsyncFileSource::_reap( bool block )
+{
+    AsyncFileIoCompletion completion;
+    if ( !_pIo->wait( completion, block ) ) return false;
+
+    const unsigned index = unsigned( completion.tag );
+    Block & b = _blocks[ index ];
+    if ( 0 < completion.result )
+    {
+        // Reads may complete short of end of file. Submit the remainder.
+        b.done += size_t( completion.result );
+        if ( b.done < _blockSize )
+        {
+            _pIo->submit( b.pBuf + b.done, _blockSize - b.done, b.offset + b.done, int( index ), index );
+            return true;
+        }
+    }
+    else if ( 0 > completion.result )
+        b.error = int( -completion.result );
+
+    b.inFlight = false;
+    --_inFlight;
+    return true;
+}
+
+void AsyncFileSource::_freeBlocks()
+{
+    for ( auto & block : _blocks )
+        free( block.pBuf );
+    _blocks.clear();
+}
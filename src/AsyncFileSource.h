@@ -0,0 +1,126 @@
+/**
+* @file AsyncFileSource.h
+* @brief The Specification for an Asynchronous Read Ahead File Source of ByteStreambuf Blocks
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_ASYNCFILESOURCE_H
+#define REISERRT_BYTESTREAMBUF_ASYNCFILESOURCE_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "AsyncIoBackend.h"
+#include "ByteStreambuf.h"
+
+#include <memory>
+#include <system_error>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        class AsyncFileIo;
+
+        /**
+        * @brief Asynchronous Read Ahead File Source of ByteStreambuf Blocks
+        *
+        * This class affords replay a way to read a file, such as one written by AsyncFileSink, in fixed size blocks
+        * while keeping a number of further blocks in flight. Blocks are returned in file order, each by way of a
+        * ByteStreambuf opened for input whose get area spans the bytes read. Only the final block may be short.
+        * Requesting the next block releases the previous one back to the read ahead.
+        *
+        * io_uring is used when the kernel affords it, with the blocks registered as fixed buffers where the locked
+        * memory limit permits. Otherwise a small thread pool performs the reads. With direct I/O requested and
+        * a block size that is a multiple of 4096 bytes, reads use O_DIRECT, bypassing the page cache.
+        *
+        * An instance is to be used from a single thread.
+        *
+        * @code AsyncFileSource source( "capture.bin" );
+        * @code while ( ByteStreambuf * pBlock = source.next() )
+        * @code     while ( pBlock->in_avail() ) decode( *pBlock );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT AsyncFileSource
+        {
+        public:
+            /**
+            * @brief Constructor for AsyncFileSource
+            *
+            * Opens the file and begins reading ahead.
+            *
+            * @param path The path of the file to read.
+            * @param blockSize The size of each block. It must not exceed 2^31 - 1 bytes.
+            * @param readAhead The number of blocks kept in flight.
+            * @param directIo If true, O_DIRECT is used where the file system and block size permit.
+            * @param backend The backend selection.
+            * @throw Throws std::system_error if the file cannot be opened or memory allocated.
+            */
+            explicit AsyncFileSource( const char * path, size_t blockSize = 1048576, unsigned readAhead = 4,
+                                      bool directIo = false, AsyncIoBackend backend = AsyncIoBackend::automatic );
+
+            /**
+            * @brief Destructor for AsyncFileSource
+            *
+            * Waits for the reads in flight to complete.
+            */
+            ~AsyncFileSource();
+
+            AsyncFileSource( const AsyncFileSource & ) = delete;
+            AsyncFileSource & operator=( const AsyncFileSource & ) = delete;
+
+            /**
+            * @brief Next Block
+            *
+            * Releases the block previously returned and waits for the next one.
+            *
+            * @return Returns the ByteStreambuf of the next block, opened for input, or nullptr at end of file.
+            * @throw Throws std::system_error if a read has failed.
+            */
+            ByteStreambuf * next();
+
+            /**
+            * @brief io_uring Query
+            *
+            * @return Returns true if io_uring is in use.
+            */
+            bool usingIoUring() const;
+
+            /**
+            * @brief Direct I/O Query
+            *
+            * @return Returns true if the file was opened with O_DIRECT.
+            */
+            bool usingDirectIo() const;
+
+        private:
+            struct Block
+            {
+                unsigned char * pBuf;
+                std::unique_ptr< ByteStreambuf > pStreambuf;
+                size_t done;
+                uint64_t offset;
+                bool inFlight;
+                int error;
+            };
+
+            void _submit( unsigned index );
+            bool _reap( bool block );
+            void _freeBlocks();
+
+            std::unique_ptr< AsyncFileIo > _pIo;
+            std::vector< Block > _blocks;
+            const size_t _blockSize;
+            unsigned _nextIndex{ 0 };
+            unsigned _inFlight{ 0 };
+            uint64_t _nextOffset{ 0 };
+            bool _held{ false };
+            bool _endOfFile{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_ASYNCFILESOURCE_H
@@ -0,0 +1,28 @@
+/**
+* @file AsyncIoBackend.h
+* @brief The Specification of Asynchronous File I/O Backend Selection
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_ASYNCIOBACKEND_H
+#define REISERRT_BYTESTREAMBUF_ASYNCIOBACKEND_H
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Asynchronous File I/O Backend Selection
+        *
+        * Selects how AsyncFileSink and AsyncFileSource perform their file I/O.
+        */
+        enum class AsyncIoBackend
+        {
+            automatic,      //!< Use io_uring when the kernel affords it, otherwise a thread pool.
+            threadPool      //!< Always use a thread pool performing pread and pwrite.
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_ASYNCIOBACKEND_H
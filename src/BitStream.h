@@ -0,0 +1,229 @@
+/**
+* @file BitStream.h
+* @brief Bit Packed Writing and Reading upon a ByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_BITSTREAM_H
+#define REISERRT_BYTESTREAMBUF_BITSTREAM_H
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Bit Writer
+        *
+        * This class packs bit fields, most significant bit first, into the put area of a ByteStreambuf.
+        * Bits are accumulated in a 64-bit word which is stored in network order each time it fills.
+        * A final flush writes any partially filled word, padded with zero bits to a whole byte.
+        *
+        * If the put area runs out of room, the writer stops writing and good() returns false.
+        */
+        class BitWriter
+        {
+        public:
+            /**
+            * @brief Constructor for BitWriter
+            *
+            * @param byteStreambuf The ByteStreambuf whose put area is written. It must out live this object.
+            */
+            explicit BitWriter( ByteStreambuf & byteStreambuf ) : _byteStreambuf( byteStreambuf ) {}
+
+            /**
+            * @brief Write Bits
+            *
+            * @param value The value whose least significant n bits are written.
+            * @param n The number of bits to write, from 0 to 64.
+            */
+            void writeBits( uint64_t value, unsigned n )
+            {
+                if ( 0 == n ) return;
+                if ( 64 > n ) value &= ( uint64_t( 1 ) << n ) - 1;
+
+                const unsigned room = 64 - _bits;
+                if ( n < room )
+                {
+                    _acc |= value << ( room - n );
+                    _bits += n;
+                }
+                else
+                {
+                    const unsigned rest = n - room;
+                    _acc |= rest ? value >> rest : value;
+                    _spill();
+                    _acc = rest ? value << ( 64 - rest ) : 0;
+                    _bits = rest;
+                }
+                _bitsWritten += n;
+            }
+
+            /**
+            * @brief Flush Bits
+            *
+            * Writes any accumulated bits, padded with zero bits to a whole byte.
+            *
+            * @return Returns good().
+            */
+            bool flush()
+            {
+                const unsigned numBytes = ( _bits + 7 ) / 8;
+                unsigned char * p = _good ? _byteStreambuf.claimPutBytes( numBytes ) : nullptr;
+                if ( p )
+                {
+                    for ( unsigned i = 0; numBytes != i; ++i )
+                        p[i] = (unsigned char)( _acc >> ( 56 - 8 * i ) );
+                }
+                else if ( 0 != numBytes ) _good = false;
+
+                _acc = 0;
+                _bits = 0;
+                _bitsWritten = ( _bitsWritten + 7 ) & ~uint64_t( 7 );
+                return _good;
+            }
+
+            /**
+            * @brief Writer State
+            *
+            * @return Returns false if the put area ran out of room.
+            */
+            bool good() const { return _good; }
+
+            /**
+            * @brief Bits Written
+            *
+            * @return Returns the number of bits written, including padding from flushes.
+            */
+            uint64_t bitsWritten() const { return _bitsWritten; }
+
+        private:
+            void _spill()
+            {
+                unsigned char * p = _good ? _byteStreambuf.claimPutBytes( sizeof( _acc ) ) : nullptr;
+                if ( p ) _storeNetOrder( p, _acc );
+                else _good = false;
+            }
+
+            ByteStreambuf & _byteStreambuf;
+            uint64_t _acc{ 0 };
+            unsigned _bits{ 0 };
+            uint64_t _bitsWritten{ 0 };
+            bool _good{ true };
+        };
+
+        /**
+        * @brief Bit Reader
+        *
+        * This class unpacks bit fields, most significant bit first, from the get area of a ByteStreambuf.
+        * Bytes are claimed from the get area ahead of the bits consumed, a word at a time where possible.
+        * Invoking finish returns unconsumed whole bytes to the get area, leaving the get position just past
+        * the last byte from which bits were read.
+        */
+        class BitReader
+        {
+        public:
+            /**
+            * @brief Constructor for BitReader
+            *
+            * @param byteStreambuf The ByteStreambuf whose get area is read. It must out live this object.
+            */
+            explicit BitReader( ByteStreambuf & byteStreambuf ) : _byteStreambuf( byteStreambuf ) {}
+
+            /**
+            * @brief Read Bits
+            *
+            * @param n The number of bits to read, from 0 to 64.
+            * @param value The value read, right aligned.
+            * @return Returns false, without consuming any bits, if fewer than n bits remain.
+            */
+            bool readBits( unsigned n, uint64_t & value )
+            {
+                if ( 56 < n )
+                {
+                    // A refill may leave fewer than 64 bits accumulated, so wide reads are made in two parts.
+                    if ( _bits + 8 * uint64_t( _byteStreambuf.in_avail() ) < n ) return false;
+                    uint64_t high = 0, low = 0;
+                    readBits( n - 32, high );
+                    readBits( 32, low );
+                    value = ( high << 32 ) | low;
+                    return true;
+                }
+                if ( !_ensure( n ) ) return false;
+                value = n ? _acc >> ( 64 - n ) : 0;
+                _acc = n ? _acc << n : _acc;
+                _bits -= n;
+                return true;
+            }
+
+            /**
+            * @brief Read a Single Bit
+            *
+            * @param bit The bit read.
+            * @return Returns false if no bits remain.
+            */
+            bool readBit( bool & bit )
+            {
+                if ( !_ensure( 1 ) ) return false;
+                bit = 0 != ( _acc >> 63 );
+                _acc <<= 1;
+                --_bits;
+                return true;
+            }
+
+            /**
+            * @brief Finish Reading
+            *
+            * Discards bits remaining in a partially consumed byte and returns any unconsumed whole bytes
+            * to the get area.
+            */
+            void finish()
+            {
+                const unsigned wholeBytes = _bits / 8;
+                if ( wholeBytes )
+                    _byteStreambuf.pubseekoff( -std::streamoff( wholeBytes ), std::ios_base::cur, std::ios_base::in );
+                _acc = 0;
+                _bits = 0;
+            }
+
+        private:
+            // Ensure at least n bits, n no more than 56, are accumulated. Bytes claimed remain accumulated
+            // even if there are not enough of them, so no bits are lost.
+            bool _ensure( unsigned n )
+            {
+                if ( n <= _bits ) return true;
+
+                // Take a whole word when the accumulator is empty, otherwise a byte at a time.
+                if ( 0 == _bits )
+                {
+                    const unsigned char * p = _byteStreambuf.claimGetBytes( sizeof( uint64_t ) );
+                    if ( p )
+                    {
+                        _acc = _loadNetOrder< uint64_t >( p );
+                        _bits = 64;
+                        return true;
+                    }
+                }
+                while ( n > _bits )
+                {
+                    const unsigned char * p = _byteStreambuf.claimGetBytes( 1 );
+                    if ( !p ) return false;
+                    _acc |= uint64_t( *p ) << ( 56 - _bits );
+                    _bits += 8;
+                }
+                return true;
+            }
+
+            ByteStreambuf & _byteStreambuf;
+            uint64_t _acc{ 0 };
+            unsigned _bits{ 0 };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_BITSTREAM_H
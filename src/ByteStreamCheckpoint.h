@@ -0,0 +1,99 @@
+/**
+* @file ByteStreamCheckpoint.h
+* @brief A Checkpoint of ByteStreambuf Positions and Stream State for Speculative Parsing
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_BYTESTREAMCHECKPOINT_H
+#define REISERRT_BYTESTREAMBUF_BYTESTREAMCHECKPOINT_H
+
+#include "ByteStreambuf.h"
+
+#include <ios>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Byte Stream Checkpoint
+        *
+        * This class captures the raw get and put positions of a ByteStreambuf and, optionally, the state of a stream
+        * using it. Unless committed, it restores both upon destruction, in constant time and without the seekoff
+        * and seekpos overrides. Clearing fail and eof bits by hand after a failed attempt is unnecessary.
+        * Checkpoints nest. Each restores only what it captured.
+        *
+        * @code ByteStreamCheckpoint checkpoint( byteStreambuf, &inputByteStream );
+        * @code if ( tryParseV2( inputByteStream ) ) checkpoint.commit();
+        * @endcode
+        */
+        class ByteStreamCheckpoint
+        {
+        public:
+            /**
+            * @brief Constructor for ByteStreamCheckpoint
+            *
+            * @param byteStreambuf The ByteStreambuf whose positions are captured.
+            * @param pStream An optional stream using the ByteStreambuf, whose state is captured.
+            */
+            explicit ByteStreamCheckpoint( ByteStreambuf & byteStreambuf,
+                                           std::basic_ios< unsigned char > * pStream = nullptr )
+              : _byteStreambuf( byteStreambuf )
+              , _pStream( pStream )
+              , _position( byteStreambuf.position() )
+              , _state( pStream ? pStream->rdstate() : std::ios_base::goodbit )
+            {
+            }
+
+            /**
+            * @brief Destructor for ByteStreamCheckpoint
+            *
+            * Rolls back unless committed. The state is restored even where it holds bits in the stream's exception
+            * mask, but no exception is raised.
+            */
+            ~ByteStreamCheckpoint()
+            {
+                if ( _committed ) return;
+
+                // Clearing to the captured state sets it before raising any failure, so swallowing it loses nothing.
+                try { rollback(); }
+                catch ( const std::ios_base::failure & ) {}
+            }
+
+            ByteStreamCheckpoint( const ByteStreamCheckpoint & ) = delete;
+            ByteStreamCheckpoint & operator=( const ByteStreamCheckpoint & ) = delete;
+
+            /**
+            * @brief Commit
+            *
+            * Keeps whatever has been read or written since the checkpoint was taken.
+            */
+            void commit() { _committed = true; }
+
+            /**
+            * @brief Roll Back
+            *
+            * Restores the positions and stream state captured. The checkpoint remains in effect, so that another
+            * interpretation may be attempted from the same point.
+            *
+            * @throw Throws std::ios_base::failure if the state restored holds bits in the stream's exception mask,
+            * as std::basic_ios::clear does. The positions and state are restored regardless.
+            */
+            void rollback()
+            {
+                _byteStreambuf.restore( _position );
+                if ( _pStream ) _pStream->clear( _state );
+            }
+
+        private:
+            ByteStreambuf & _byteStreambuf;
+            std::basic_ios< unsigned char > * const _pStream;
+            const ByteStreambuf::Position _position;
+            const std::ios_base::iostate _state;
+            bool _committed{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_BYTESTREAMCHECKPOINT_H
@@ -5,9 +5,23 @@
 * @date Created on November 13, 2022
 */
 
+#ifndef REISERRT_BYTESTREAMBUF_BYTESTREAMBUF_H
+#define REISERRT_BYTESTREAMBUF_BYTESTREAMBUF_H
+
 #include "ReiserRT_ByteStreambufExport.h"
 
 #include <iostream>
+#include <limits>
+#include <cstddef>
+
+// When building header only, every ByteStreambuf operation is defined inline within the
+// including translation unit so that it may be inlined into decode loops. Otherwise, they are compiled
+// into the library.
+#ifdef ReiserRT_ByteStreambuf_HEADER_ONLY
+#define ReiserRT_ByteStreambuf_INLINE inline
+#else
+#define ReiserRT_ByteStreambuf_INLINE
+#endif
 
 namespace ReiserRT
 {
@@ -44,6 +58,10 @@ namespace ReiserRT
         *
         * Now you can do reads over the space with robust EOF detection although the
         * initial intent was unformatted input.
+        *
+        * The overridden operations are declared final and the claimGetBytes and claimPutBytes operations are
+        * non-virtual, so that the serialization overloads taking a ByteStreambuf directly may bypass the
+        * virtual basic_streambuf interface and the stream sentries entirely.
         */
         class ReiserRT_ByteStreambuf_EXPORT ByteStreambuf : public std::basic_streambuf< unsigned char >
         {
@@ -61,6 +79,103 @@ namespace ReiserRT
             explicit ByteStreambuf( char_type * pBuf, std::streamsize len,
                         std::ios_base::openmode _openMode = std::ios_base::in | std::ios_base::out );
 
+            /**
+            * @brief Claim Bytes from the Get Area
+            *
+            * This operation affords direct access to the get area without virtual dispatch or an istream sentry.
+            * If at least n bytes remain to be read, the get position is advanced past them and
+            * a pointer to the first of them is returned. Otherwise, the get position is left unchanged.
+            *
+            * @param n The number of bytes to claim.
+            * @return Returns a pointer to the n bytes claimed or nullptr if fewer than n bytes remain.
+            */
+            const char_type * claimGetBytes( std::size_t n )
+            {
+                char_type * const p = gptr();
+                if ( std::size_t( egptr() - p ) < n ) return nullptr;
+                setg( eback(), p + n, egptr() );
+                return p;
+            }
+
+            /**
+            * @brief Claim Bytes from the Put Area
+            *
+            * This operation affords direct access to the put area without virtual dispatch or an ostream sentry.
+            * If at least n bytes of room remain, the put position is advanced past them and
+            * a pointer to the first of them is returned for the caller to fill. Otherwise, the put position
+            * is left unchanged.
+            *
+            * @param n The number of bytes to claim.
+            * @return Returns a pointer to the n bytes claimed or nullptr if fewer than n bytes of room remain.
+            */
+            char_type * claimPutBytes( std::size_t n )
+            {
+                char_type * const p = pptr();
+                if ( std::size_t( epptr() - p ) < n ) return nullptr;
+                _advancePut( n );
+                return p;
+            }
+
+            /**
+            * @brief Get Area Beginning
+            *
+            * @return Returns a pointer to the start of the get area, or nullptr if not opened for input.
+            */
+            const char_type * getAreaBegin() const { return eback(); }
+
+            /**
+            * @brief Get Area End
+            *
+            * @return Returns a pointer one past the end of the get area, or nullptr if not opened for input.
+            */
+            const char_type * getAreaEnd() const { return egptr(); }
+
+            /**
+            * @brief Put Area Beginning
+            *
+            * What has been written lies between this and the put position.
+            *
+            * @return Returns a pointer to the start of the put area, or nullptr if not opened for output.
+            */
+            const char_type * putAreaBegin() const { return pbase(); }
+
+            /**
+            * @brief Raw Get and Put Positions
+            *
+            * A snapshot of the get and put pointers, restored in constant time without seekoff or seekpos.
+            */
+            struct Position
+            {
+                char_type * pGet;   //!< The get pointer, or nullptr if not opened for input.
+                char_type * pPut;   //!< The put pointer, or nullptr if not opened for output.
+            };
+
+            /**
+            * @brief Capture the Raw Positions
+            *
+            * @return Returns the current get and put pointers.
+            */
+            Position position() const { return Position{ gptr(), pptr() }; }
+
+            /**
+            * @brief Restore Raw Positions
+            *
+            * Restores positions previously captured from this ByteStreambuf, provided its buffer has not since been
+            * replaced by setbuf.
+            *
+            * @param pos The positions to restore.
+            */
+            void restore( const Position & pos )
+            {
+                if ( _M_openMode & std::ios_base::in )
+                    setg( eback(), pos.pGet, egptr() );
+                if ( _M_openMode & std::ios_base::out )
+                {
+                    setp( pbase(), epptr() );
+                    _advancePut( std::size_t( pos.pPut - pbase() ) );
+                }
+            }
+
         protected:
             /**
             * @brief Set the Buffer for ByteStreamBuf
@@ -72,16 +187,35 @@ namespace ReiserRT
             * @param len The length of the buffer to be utilized for buffering.
             * @return Returns a pointer to the ByteStreamBuf object operated on.
             */
-            ByteStreambuf * setbuf( char_type * pBuf, std::streamsize len );
+            ByteStreambuf * setbuf( char_type * pBuf, std::streamsize len ) override final;
 
 
             ///@todo Document as an override
             std::streampos seekoff( std::streamoff off, std::ios_base::seekdir way,
-                        std::ios_base::openmode which );
+                        std::ios_base::openmode which ) override final;
 
 
             ///@todo Document as an override
-            std::streampos seekpos( std::streampos pos, std::ios_base::openmode which );
+            std::streampos seekpos( std::streampos pos, std::ios_base::openmode which ) override final;
+
+            /**
+            * @brief Advance the Put Position
+            *
+            * The standard pbump takes an int. This advances the put position by any amount, in int sized steps.
+            * The caller is responsible for ensuring there is room.
+            *
+            * @param n The number of bytes to advance the put position by.
+            */
+            void _advancePut( std::size_t n )
+            {
+                while ( 0 != n )
+                {
+                    const int step = n > std::size_t( std::numeric_limits< int >::max() ) ?
+                                     std::numeric_limits< int >::max() : int( n );
+                    pbump( step );
+                    n -= std::size_t( step );
+                }
+            }
 
         protected:
             /**
@@ -94,4 +228,10 @@ namespace ReiserRT
 
 
     }
-}
\ No newline at end of file
+}
+
+#ifdef ReiserRT_ByteStreambuf_HEADER_ONLY
+#include "ByteStreambufInline.h"
+#endif
+
+#endif //REISERRT_BYTESTREAMBUF_BYTESTREAMBUF_H
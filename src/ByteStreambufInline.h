@@ -0,0 +1,127 @@
+/**
+* @file ByteStreambufInline.h
+* @brief The Implementation for a ByteStream Buffer Utility.
+*
+* This file is included by ByteStreambuf.cpp when building the compiled libraries and by ByteStreambuf.h when
+* ReiserRT_ByteStreambuf_HEADER_ONLY is defined, in which case every operation is declared inline.
+*
+* @authors Frank Reiser
+* @date Created on November 13, 2022
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_BYTESTREAMBUFINLINE_H
+#define REISERRT_BYTESTREAMBUF_BYTESTREAMBUFINLINE_H
+
+#include "ByteStreambuf.h"
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        ReiserRT_ByteStreambuf_INLINE ByteStreambuf::ByteStreambuf( char_type * pBuf, std::streamsize len,
+                                                                    std::ios_base::openmode _openMode )
+          : std::basic_streambuf< unsigned char >()
+          , _M_openMode( _openMode )
+        {
+            if ( _M_openMode & std::ios_base::in )
+                setg(pBuf, pBuf, pBuf + len );
+            if ( _M_openMode & std::ios_base::out )
+                setp(pBuf, pBuf + len );
+        }
+
+        ReiserRT_ByteStreambuf_INLINE ByteStreambuf * ByteStreambuf::setbuf( char_type * pBuf, std::streamsize len )
+        {
+            if ( _M_openMode & std::ios_base::in )
+                setg(pBuf, pBuf, pBuf + len );
+            if ( _M_openMode & std::ios_base::out )
+                setp(pBuf, pBuf + len );
+
+            return this;
+        }
+
+        ReiserRT_ByteStreambuf_INLINE std::streampos ByteStreambuf::seekoff( std::streamoff off,
+                                                                             std::ios_base::seekdir way,
+                                                                             std::ios_base::openmode which )
+        {
+            std::streampos retVal = -1;
+
+            // If performing input
+            if ( ( which & std::ios_base::in ) && ( _M_openMode & std::ios_base::in ) )
+            {
+                // Get current offset
+                const std::streampos curOffset = gptr() - eback();
+
+                // If seek off is zero from current position, just return the current offset.
+                // This is more of a query used by istream::tellg()
+                if ( 0 == off && std::ios_base::cur == way ) retVal = curOffset;
+
+                // Otherwise, seek based on seek direction
+                else {
+                    if ( std::ios_base::cur == way ) retVal = seekpos( curOffset + off, std::ios_base::in );
+                    else if ( std::ios_base::beg == way ) retVal = seekpos( off, std::ios_base::in );
+                    else if ( std::ios_base::end == way ) retVal = seekpos( egptr() - eback() + off, std::ios_base::in );
+                }
+            }
+
+            // If performing output
+            if ( ( which & std::ios_base::out ) && ( _M_openMode & std::ios_base::out ) )
+            {
+                // Get current offset
+                const std::streampos curOffset = pptr() - pbase();
+
+                // If seek off is zero from current position, just return the current offset.
+                if ( 0 == off && std::ios_base::cur == way ) retVal = curOffset;
+
+                // Otherwise, seek based on seek direction
+                else {
+                    if ( std::ios_base::cur == way ) retVal = seekpos( curOffset + off, std::ios_base::out );
+                    else if ( std::ios_base::beg == way ) retVal = seekpos( off, std::ios_base::out );
+                    else if ( std::ios_base::end == way ) retVal = seekpos( epptr() - pbase() + off, std::ios_base::out );
+                }
+            }
+
+            return retVal;
+        }
+
+        ReiserRT_ByteStreambuf_INLINE std::streampos ByteStreambuf::seekpos( std::streampos pos, std::ios_base::openmode which )
+        {
+            std::streampos retVal = -1;
+
+            if ( ( which & std::ios_base::in ) && ( _M_openMode & std::ios_base::in ) )
+            {
+                const std::streampos curOffset = gptr() - eback();
+                if ( curOffset == pos )
+                {
+                    retVal = curOffset;
+                }
+                else if ( 0 <= pos && egptr() >= ( eback() + pos ) )
+                {
+                    // Note: We use setg rather than gbump here as gbump takes an int which would truncate
+                    // positions within multi-gigabyte buffers.
+                    setg( eback(), eback() + pos, egptr() );
+                    retVal = pos;
+                }
+            }
+
+            if ( ( which & std::ios_base::out ) && ( _M_openMode & std::ios_base::out ) )
+            {
+                const std::streampos curOffset = pptr() - pbase();
+                if ( curOffset == pos )
+                {
+                    retVal = curOffset;
+                }
+                else if ( 0 <= pos && epptr() >= ( pbase() + pos ) )
+                {
+                    // Note: There is no setp equivalent that positions the put pointer, so we reset it and advance it.
+                    setp( pbase(), epptr() );
+                    _advancePut( std::size_t( std::streamoff( pos ) ) );
+                    retVal = pos;
+                }
+            }
+
+            return retVal;
+        }
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_BYTESTREAMBUFINLINE_H
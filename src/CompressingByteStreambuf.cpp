@@ -0,0 +1,89 @@
+/**
+* @file CompressingByteStreambuf.cpp
+* @brief The Implementation for a Block Compressing Output Byte Stream Buffer
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "CompressingByteStreambuf.h"
+#include "LzBlockCodec.h"
+#include "Serialization.h"
+
+#include <stdexcept>
+
+using namespace ReiserRT::Utility;
+
+constexpr uint32_t CompressedFrameFormat::storedRawFlag;
+constexpr size_t CompressedFrameFormat::headerSize;
+
+namespace
+{
+    // The stored length of a frame shares its 32 bits with the stored raw flag.
+    size_t checkedBlockSize( size_t blockSize )
+    {
+        if ( blockSize >= CompressedFrameFormat::storedRawFlag )
+            throw std::invalid_argument( "CompressingByteStreambuf: block size exceeds 2^31 - 1" );
+        return 0 == blockSize ? 1 : blockSize;
+    }
+}
+
+CompressingByteStreambuf::CompressingByteStreambuf( OutputByteStream & downstream, size_t blockSize )
+  : std::basic_streambuf< unsigned char >()
+  , _downstream( downstream )
+  , _block( checkedBlockSize( blockSize ) )
+  , _scratch( _block.size() )
+{
+    setp( _block.data(), _block.data() + _block.size() );
+}
+
+CompressingByteStreambuf::~CompressingByteStreambuf()
+{
+    // A downstream with exceptions enabled may throw, which must not escape a destructor.
+    try
+    {
+        _writeBlock();
+    }
+    catch ( ... )
+    {
+    }
+}
+
+CompressingByteStreambuf::int_type CompressingByteStreambuf::overflow( int_type c )
+{
+    if ( !_writeBlock() ) return traits_type::eof();
+
+    if ( !traits_type::eq_int_type( c, traits_type::eof() ) )
+    {
+        *pptr() = traits_type::to_char_type( c );
+        pbump( 1 );
+        return c;
+    }
+    return traits_type::not_eof( c );
+}
+
+int CompressingByteStreambuf::sync()
+{
+    return _writeBlock() ? 0 : -1;
+}
+
+bool CompressingByteStreambuf::_writeBlock()
+{
+    const size_t rawLen = size_t( pptr() - pbase() );
+    if ( 0 == rawLen ) return bool( _downstream );
+
+    // Store the block raw when it does not compress into fewer bytes, which is all the scratch holds.
+    const size_t compressedLen = LzBlockCodec::compress( pbase(), rawLen, _scratch.data(), rawLen );
+    const bool storedRaw = 0 == compressedLen;
+    const size_t storedLen = storedRaw ? rawLen : compressedLen;
+
+    typeToNet( uint32_t( rawLen ), _downstream );
+    typeToNet( uint32_t( storedLen ) | ( storedRaw ? CompressedFrameFormat::storedRawFlag : 0 ), _downstream );
+    _downstream.write( storedRaw ? pbase() : _scratch.data(), std::streamsize( storedLen ) );
+
+    _bytesIn += rawLen;
+    setp( _block.data(), _block.data() + _block.size() );
+    if ( !_downstream ) return false;
+
+    _bytesOut += CompressedFrameFormat::headerSize + storedLen;
+    return true;
+}
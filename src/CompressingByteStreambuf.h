@@ -0,0 +1,117 @@
+/**
+* @file CompressingByteStreambuf.h
+* @brief The Specification for a Block Compressing Output Byte Stream Buffer
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_COMPRESSINGBYTESTREAMBUF_H
+#define REISERRT_BYTESTREAMBUF_COMPRESSINGBYTESTREAMBUF_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreamTypesFwd.h"
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Compressed Block Frame Format Constants
+        *
+        * Each compressed block written by CompressingByteStreambuf is framed by a 32-bit, network ordered
+        * uncompressed length followed by a 32-bit, network ordered stored length, followed by the stored bytes.
+        * If the most significant bit of the stored length is set, the block was incompressible and is stored raw.
+        */
+        struct CompressedFrameFormat
+        {
+            static constexpr uint32_t storedRawFlag = 0x80000000;   //!< Set in the stored length of raw blocks.
+            static constexpr size_t headerSize = 8;                 //!< Size of a frame header.
+        };
+
+        /**
+        * @brief Block Compressing Output Byte Stream Buffer
+        *
+        * This class affords an OutputByteStream which compresses what is written to it, block by block,
+        * onto a downstream OutputByteStream. Bytes are buffered into a fixed size block. When the block fills,
+        * or upon sync (OutputByteStream::flush), it is compressed with LzBlockCodec and written downstream as a frame.
+        * This removes the intermediate serialized copy and memory pass of compressing afterwards.
+        *
+        * Unlike ByteStreambuf, this class owns its block and compression scratch memory. The downstream stream
+        * must out live it. Any partially filled block is written upon destruction.
+        *
+        * @code CompressingByteStreambuf compressingByteStreambuf( archiveByteStream );
+        * @code OutputByteStream outputByteStream( &compressingByteStreambuf );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT CompressingByteStreambuf final : public std::basic_streambuf< unsigned char >
+        {
+        public:
+            /**
+            * @brief Constructor for CompressingByteStreambuf
+            *
+            * @param downstream The output byte stream that compressed frames are written to.
+            * @param blockSize The uncompressed size of each block. It must not exceed 2^31 - 1 bytes.
+            * @throw Throws std::invalid_argument if the block size exceeds 2^31 - 1 bytes.
+            */
+            explicit CompressingByteStreambuf( OutputByteStream & downstream, size_t blockSize = 65536 );
+
+            /**
+            * @brief Destructor for CompressingByteStreambuf
+            *
+            * Writes any partially filled block downstream. A failure to do so, including an exception thrown by
+            * the downstream stream, is swallowed. Invoke pubsync beforehand to learn whether the final block was written.
+            */
+            ~CompressingByteStreambuf() override;
+
+            /**
+            * @brief Uncompressed Bytes Written
+            *
+            * @return Returns the number of uncompressed bytes accepted, including those not yet compressed.
+            */
+            uint64_t bytesIn() const { return _bytesIn + uint64_t( pptr() - pbase() ); }
+
+            /**
+            * @brief Framed Bytes Written Downstream
+            *
+            * @return Returns the number of bytes written downstream, including frame headers.
+            */
+            uint64_t bytesOut() const { return _bytesOut; }
+
+        protected:
+            /**
+            * @brief Overflow Override
+            *
+            * Compresses the full block downstream and then buffers the character provided, if any.
+            *
+            * @param c The character which did not fit or eof.
+            * @return Returns a value other than eof on success. Returns eof if writing downstream failed.
+            */
+            int_type overflow( int_type c ) override;
+
+            /**
+            * @brief Sync Override
+            *
+            * Compresses any partially filled block downstream.
+            *
+            * @return Returns zero on success, or -1 if writing downstream failed.
+            */
+            int sync() override;
+
+        private:
+            bool _writeBlock();
+
+            OutputByteStream & _downstream;
+            std::vector< unsigned char > _block;
+            std::vector< unsigned char > _scratch;
+            uint64_t _bytesIn{ 0 };
+            uint64_t _bytesOut{ 0 };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_COMPRESSINGBYTESTREAMBUF_H
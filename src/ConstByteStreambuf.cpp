@@ -0,0 +1,8 @@
+/**
+* @file ConstByteStreambuf.cpp
+* @brief This file merely includes the header file which is all inline code.
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ConstByteStreambuf.h"
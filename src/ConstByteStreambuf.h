@@ -0,0 +1,56 @@
+/**
+* @file ConstByteStreambuf.h
+* @brief The Specification for a Read Only ByteStream Buffer Utility.
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_CONSTBYTESTREAMBUF_H
+#define REISERRT_BYTESTREAMBUF_CONSTBYTESTREAMBUF_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreambuf.h"
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Read Only Byte Stream Buffer Implementation
+        *
+        * This class is a ByteStreambuf which is always opened in std::ios_base::in mode over user provided
+        * memory that it may not write to. It exists so that read only memory, such as a PROT_READ memory mapping,
+        * shared memory mapped read only between processes or a const receive buffer, may be used with
+        * an InputByteStream and every netToType overload without a const_cast or a defensive copy.
+        *
+        * No put area is ever established. Putting back a character which differs from the one
+        * previously extracted fails, as it does for ByteStreambuf, rather than writing to the memory.
+        * As with ByteStreambuf, this class does not take ownership of the user provided memory.
+        *
+        * @code ConstByteStreambuf constByteStreambuf( pConstBytes, length );
+        * @code InputByteStream inputByteStream( &constByteStreambuf );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT ConstByteStreambuf final : public ByteStreambuf
+        {
+        public:
+            /**
+            * @brief Constructor for ConstByteStreambuf
+            *
+            * This constructor initializes the stream buffer for input only, setting up the get stream buffer pointers.
+            *
+            * @param pBuf A pointer to a read only octet block (unsigned char - byte) to be utilized for buffering.
+            * @param len The length of the octet block.
+            */
+            ConstByteStreambuf( const char_type * pBuf, std::streamsize len )
+              : ByteStreambuf( const_cast< char_type * >( pBuf ), len, std::ios_base::in )
+            {
+                // Note: The const_cast is safe. The base class only writes through the put area pointers,
+                // which are never established when opened in std::ios_base::in mode.
+            }
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_CONSTBYTESTREAMBUF_H
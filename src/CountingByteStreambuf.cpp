@@ -0,0 +1,56 @@
+/**
+* @file CountingByteStreambuf.cpp
+* @brief The Implementation for a Null Sink Stream Buffer Counting the Bytes Written
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "CountingByteStreambuf.h"
+
+using namespace ReiserRT::Utility;
+
+constexpr size_t CountingByteStreambuf::scratchSize;
+
+CountingByteStreambuf::CountingByteStreambuf()
+  : std::basic_streambuf< unsigned char >()
+{
+    setp( _scratch, _scratch + scratchSize );
+}
+
+CountingByteStreambuf::int_type CountingByteStreambuf::overflow( int_type c )
+{
+    _base += pptr() - pbase();
+    setp( _scratch, _scratch + scratchSize );
+    if ( !traits_type::eq_int_type( c, traits_type::eof() ) ) ++_base;
+    return traits_type::not_eof( c );
+}
+
+std::streamsize CountingByteStreambuf::xsputn( const char_type *, std::streamsize n )
+{
+    _base += n;
+    return n;
+}
+
+std::streampos CountingByteStreambuf::seekoff( std::streamoff off, std::ios_base::seekdir way,
+                                               std::ios_base::openmode which )
+{
+    if ( !( which & std::ios_base::out ) ) return -1;
+
+    // A query, as used by tellp.
+    if ( 0 == off && std::ios_base::cur == way ) return position();
+
+    if ( std::ios_base::cur == way ) off += position();
+    else if ( std::ios_base::end == way ) off += std::streamoff( size() );
+    return seekpos( off, which );
+}
+
+std::streampos CountingByteStreambuf::seekpos( std::streampos pos, std::ios_base::openmode which )
+{
+    if ( !( which & std::ios_base::out ) ) return -1;
+    if ( 0 > pos || std::streamoff( size() ) < pos ) return -1;
+
+    _highWater = std::streamoff( size() );
+    _base = pos;
+    setp( _scratch, _scratch + scratchSize );
+    return pos;
+}
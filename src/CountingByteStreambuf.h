@@ -0,0 +1,165 @@
+/**
+* @file CountingByteStreambuf.h
+* @brief The Specification for a Null Sink Stream Buffer Counting the Bytes Written
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_COUNTINGBYTESTREAMBUF_H
+#define REISERRT_BYTESTREAMBUF_COUNTINGBYTESTREAMBUF_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include <iostream>
+#include <type_traits>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Counting Byte Stream Buffer
+        *
+        * This class is an output only stream buffer which discards what is written to it, counting the bytes instead,
+        * so that the exact size of a serialization may be computed before a buffer is allocated for it.
+        * It accepts put, write and typeToNet through an OutputByteStream, and typeToNet directly.
+        *
+        * Seeking is supported anywhere between the beginning and the furthest position reached, so that serialization
+        * code which backpatches, seeking back to fill in a length and then returning to the end, sizes correctly.
+        * The size is the furthest position reached, not the current position.
+        *
+        * Single characters land in a small scratch put area which is never read, so that putting costs what it does
+        * for a ByteStreambuf. Blocks written are counted without being copied.
+        *
+        * @code CountingByteStreambuf countingByteStreambuf;
+        * @code OutputByteStream counter( &countingByteStreambuf );
+        * @code serialize( message, counter );
+        * @code std::vector< unsigned char > buffer( countingByteStreambuf.size() );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT CountingByteStreambuf : public std::basic_streambuf< unsigned char >
+        {
+        public:
+            /**
+            * @brief Constructor for CountingByteStreambuf
+            *
+            * The count begins at zero.
+            */
+            CountingByteStreambuf();
+
+            CountingByteStreambuf( const CountingByteStreambuf & ) = delete;
+            CountingByteStreambuf & operator=( const CountingByteStreambuf & ) = delete;
+
+            /**
+            * @brief Current Position
+            *
+            * @return Returns the put position, as tellp would.
+            */
+            std::streamoff position() const { return _base + ( pptr() - pbase() ); }
+
+            /**
+            * @brief Size
+            *
+            * @return Returns the number of bytes that would have been written, the furthest position reached.
+            */
+            size_t size() const
+            {
+                const std::streamoff pos = position();
+                return size_t( pos > _highWater ? pos : _highWater );
+            }
+
+            /**
+            * @brief Advance the Put Position
+            *
+            * Counts n bytes as written, for serialization which claims bytes directly rather than putting them.
+            *
+            * @param n The number of bytes.
+            */
+            void advance( size_t n ) { _base += std::streamoff( n ); }
+
+            /**
+            * @brief Reset
+            *
+            * Returns the position and size to zero, so that another serialization may be counted.
+            */
+            void reset()
+            {
+                _base = 0;
+                _highWater = 0;
+                setp( _scratch, _scratch + scratchSize );
+            }
+
+        protected:
+            /**
+            * @brief Overflow
+            *
+            * Invoked when the scratch put area is full. Counts it, and the character, and starts it over.
+            *
+            * @param c The character put.
+            * @return Returns a value other than EOF.
+            */
+            int_type overflow( int_type c ) override final;
+
+            /**
+            * @brief Put a Block of Characters
+            *
+            * Counts the characters without copying them.
+            *
+            * @param pChars The characters.
+            * @param n The number of characters.
+            * @return Returns n.
+            */
+            std::streamsize xsputn( const char_type * pChars, std::streamsize n ) override final;
+
+            /**
+            * @brief Seek by Offset
+            *
+            * Only the put position may be sought. The position sought must lie between zero and the size.
+            *
+            * @return Returns the new position, or -1 if it could not be sought.
+            */
+            std::streampos seekoff( std::streamoff off, std::ios_base::seekdir way,
+                                    std::ios_base::openmode which ) override final;
+
+            /**
+            * @brief Seek to a Position
+            *
+            * Only the put position may be sought. The position sought must lie between zero and the size.
+            *
+            * @return Returns the new position, or -1 if it could not be sought.
+            */
+            std::streampos seekpos( std::streampos pos, std::ios_base::openmode which ) override final;
+
+        private:
+            static constexpr size_t scratchSize = 256;
+
+            // Large enough that overflow, a virtual call, is seldom invoked.
+            char_type _scratch[ scratchSize ];
+            std::streamoff _base{ 0 };          // The position of the start of the scratch put area.
+            std::streamoff _highWater{ 0 };     // The furthest position reached before the most recent seek.
+        };
+
+        /**
+        * @brief Count a Type onto a CountingByteStreambuf.
+        *
+        * This template operation counts the bytes typeToNet would write, without virtual dispatch or a sentry.
+        *
+        * @tparam T Type T is the type to count. It must be a numeric or enumerator type.
+        * @param t The value which would be serialized.
+        * @param countingByteStreambuf A reference to the CountingByteStreambuf to count the bytes with.
+        * @return The number of bytes which would be serialized, sizeof( T ).
+        */
+        template < typename T >
+        size_t typeToNet( const T & t, CountingByteStreambuf & countingByteStreambuf )
+        {
+            static_assert( std::is_integral<T>::value || std::is_floating_point<T>::value || std::is_enum<T>::value,
+                           "Type T must be an integer, floating point or enumerator type" );
+            (void)t;
+            countingByteStreambuf.advance( sizeof( T ) );
+            return sizeof( T );
+        }
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_COUNTINGBYTESTREAMBUF_H
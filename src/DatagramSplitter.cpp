@@ -0,0 +1,45 @@
+/**
+* @file DatagramSplitter.cpp
+* @brief The Implementation for Iterating the Messages of a Coalesced Datagram Without Copying
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "DatagramSplitter.h"
+#include "MessageCoalescer.h"
+#include "Serialization.h"
+
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+DatagramSplitter::DatagramSplitter( const unsigned char * pDatagram, size_t len )
+  : _pNext( pDatagram )
+  , _pEnd( pDatagram + len )
+  , _message( pDatagram, 0 )
+  , _stream( &_message )
+{
+}
+
+InputByteStream * DatagramSplitter::next()
+{
+    if ( _pNext == _pEnd || _malformed ) return nullptr;
+
+    if ( size_t( _pEnd - _pNext ) < CoalescedDatagramFormat::lengthPrefixSize )
+    {
+        _malformed = true;
+        return nullptr;
+    }
+    const size_t len = _loadNetOrder< uint16_t >( _pNext );
+    const unsigned char * const pMessage = _pNext + CoalescedDatagramFormat::lengthPrefixSize;
+    if ( size_t( _pEnd - pMessage ) < len )
+    {
+        _malformed = true;
+        return nullptr;
+    }
+
+    _pNext = pMessage + len;
+    _message.pubsetbuf( const_cast< unsigned char * >( pMessage ), std::streamsize( len ) );
+    _stream.clear();
+    return &_stream;
+}
@@ -0,0 +1,84 @@
+/**
+* @file DatagramSplitter.h
+* @brief The Specification for Iterating the Messages of a Coalesced Datagram Without Copying
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_DATAGRAMSPLITTER_H
+#define REISERRT_BYTESTREAMBUF_DATAGRAMSPLITTER_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreamTypesFwd.h"
+#include "ConstByteStreambuf.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Coalesced Datagram Splitter
+        *
+        * This class iterates the length delimited messages of a datagram coalesced by MessageCoalescer.
+        * Each message is presented by an InputByteStream over its sub range of the datagram. Nothing is copied.
+        * The stream and its ConstByteStreambuf are reused from message to message, so the cost of constructing
+        * an istream is paid once per datagram rather than once per message.
+        *
+        * As with ByteStreambuf, this class does not take ownership of the datagram memory.
+        *
+        * @code DatagramSplitter splitter( pDatagram, length );
+        * @code while ( InputByteStream * pMessage = splitter.next() )
+        * @code     decode( *pMessage );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT DatagramSplitter
+        {
+        public:
+            /**
+            * @brief Constructor for DatagramSplitter
+            *
+            * @param pDatagram The received datagram.
+            * @param len The length of the datagram.
+            */
+            DatagramSplitter( const unsigned char * pDatagram, size_t len );
+
+            DatagramSplitter( const DatagramSplitter & ) = delete;
+            DatagramSplitter & operator=( const DatagramSplitter & ) = delete;
+
+            /**
+            * @brief Next Message
+            *
+            * @return Returns an InputByteStream, in a good state, over the next message, or nullptr if there are
+            * no more or the remainder of the datagram is malformed.
+            */
+            InputByteStream * next();
+
+            /**
+            * @brief Current Message Stream Buffer
+            *
+            * @return Returns the ConstByteStreambuf over the message last returned by next, for use with the
+            * serialization overloads operating directly upon a ByteStreambuf.
+            */
+            ConstByteStreambuf & streambuf() { return _message; }
+
+            /**
+            * @brief Malformed Query
+            *
+            * @return Returns true if a length prefix was truncated or described more bytes than remain.
+            */
+            bool malformed() const { return _malformed; }
+
+        private:
+            const unsigned char * _pNext;
+            const unsigned char * const _pEnd;
+            ConstByteStreambuf _message;
+            InputByteStream _stream;
+            bool _malformed{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_DATAGRAMSPLITTER_H
@@ -0,0 +1,69 @@
+/**
+* @file DecompressingByteStreambuf.cpp
+* @brief The Implementation for a Block Decompressing Input Byte Stream Buffer
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "DecompressingByteStreambuf.h"
+#include "CompressingByteStreambuf.h"
+#include "LzBlockCodec.h"
+#include "Serialization.h"
+
+using namespace ReiserRT::Utility;
+
+DecompressingByteStreambuf::DecompressingByteStreambuf( InputByteStream & upstream, size_t maxBlockSize )
+  : std::basic_streambuf< unsigned char >()
+  , _upstream( upstream )
+  , _block( 0 == maxBlockSize ? 1 : maxBlockSize )
+  , _scratch( _block.size() )
+{
+    setg( _block.data(), _block.data(), _block.data() );
+}
+
+DecompressingByteStreambuf::int_type DecompressingByteStreambuf::underflow()
+{
+    if ( gptr() < egptr() ) return traits_type::to_int_type( *gptr() );
+    if ( _corrupt ) return traits_type::eof();
+
+    // Empty frames are skipped.
+    while ( gptr() == egptr() )
+    {
+        // A clean end of the upstream lands exactly on a frame boundary.
+        uint32_t rawLen;
+        const auto headerBytes = netToType( _upstream, rawLen );
+        if ( 0 == headerBytes ) return traits_type::eof();
+
+        uint32_t storedLen;
+        if ( sizeof( rawLen ) != headerBytes || sizeof( storedLen ) != netToType( _upstream, storedLen ) )
+        {
+            _corrupt = true;
+            return traits_type::eof();
+        }
+
+        const bool storedRaw = 0 != ( storedLen & CompressedFrameFormat::storedRawFlag );
+        storedLen &= ~CompressedFrameFormat::storedRawFlag;
+        if ( rawLen > _block.size() || storedLen > _scratch.size() || ( storedRaw && storedLen != rawLen ) )
+        {
+            _corrupt = true;
+            return traits_type::eof();
+        }
+
+        unsigned char * pStored = storedRaw ? _block.data() : _scratch.data();
+        if ( !_upstream.read( pStored, std::streamsize( storedLen ) ) )
+        {
+            _corrupt = true;
+            return traits_type::eof();
+        }
+
+        if ( !storedRaw && rawLen != LzBlockCodec::decompress( pStored, storedLen, _block.data(), rawLen ) )
+        {
+            _corrupt = true;
+            return traits_type::eof();
+        }
+
+        setg( _block.data(), _block.data(), _block.data() + rawLen );
+    }
+
+    return traits_type::to_int_type( *gptr() );
+}
@@ -0,0 +1,74 @@
+/**
+* @file DecompressingByteStreambuf.h
+* @brief The Specification for a Block Decompressing Input Byte Stream Buffer
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_DECOMPRESSINGBYTESTREAMBUF_H
+#define REISERRT_BYTESTREAMBUF_DECOMPRESSINGBYTESTREAMBUF_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreamTypesFwd.h"
+
+#include <iostream>
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Block Decompressing Input Byte Stream Buffer
+        *
+        * This class affords an InputByteStream over frames written by CompressingByteStreambuf onto an upstream
+        * InputByteStream. Decompression is lazy. A frame is read and decompressed only upon underflow,
+        * when the previous block has been consumed.
+        *
+        * A malformed frame, or one whose uncompressed length exceeds the maximum block size, is treated as an EOF
+        * condition and may be detected with corrupt(). As with the compressing buffer, this class owns its memory.
+        *
+        * @code DecompressingByteStreambuf decompressingByteStreambuf( archiveByteStream );
+        * @code InputByteStream inputByteStream( &decompressingByteStreambuf );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT DecompressingByteStreambuf final : public std::basic_streambuf< unsigned char >
+        {
+        public:
+            /**
+            * @brief Constructor for DecompressingByteStreambuf
+            *
+            * @param upstream The input byte stream that compressed frames are read from.
+            * @param maxBlockSize The largest uncompressed block accepted. It must be at least the block size used
+            * when compressing.
+            */
+            explicit DecompressingByteStreambuf( InputByteStream & upstream, size_t maxBlockSize = 65536 );
+
+            /**
+            * @brief Corrupt Frame Detected
+            *
+            * @return Returns true if underflow stopped due to a malformed frame rather than the end of the upstream.
+            */
+            bool corrupt() const { return _corrupt; }
+
+        protected:
+            /**
+            * @brief Underflow Override
+            *
+            * Reads and decompresses the next frame from upstream.
+            *
+            * @return Returns the next character or eof at the end of the upstream or upon a malformed frame.
+            */
+            int_type underflow() override;
+
+        private:
+            InputByteStream & _upstream;
+            std::vector< unsigned char > _block;
+            std::vector< unsigned char > _scratch;
+            bool _corrupt{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_DECOMPRESSINGBYTESTREAMBUF_H
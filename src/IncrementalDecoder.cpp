@@ -0,0 +1,147 @@
+/**
+* @file IncrementalDecoder.cpp
+* @brief The Implementation for a Resumable Decoder of Messages Received in Segments
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "IncrementalDecoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    size_t available( const ByteStreambuf & segment )
+    {
+        return size_t( segment.getAreaEnd() - segment.position().pGet );
+    }
+}
+
+IncrementalDecoder & IncrementalDecoder::bytes( unsigned char * pBytes, size_t len )
+{
+    Step step{};
+    step.kind = Step::Kind::fixedBytes;
+    step.pDest = pBytes;
+    step.elementSize = 1;
+    step.fixedLength = len;
+    _steps.push_back( step );
+    return *this;
+}
+
+IncrementalDecoder & IncrementalDecoder::skip( size_t len )
+{
+    Step step{};
+    step.kind = Step::Kind::skip;
+    step.elementSize = 1;
+    step.fixedLength = len;
+    _steps.push_back( step );
+    return *this;
+}
+
+IncrementalDecoder::Status IncrementalDecoder::decode( ByteStreambuf & segment )
+{
+    if ( _invalid ) return Status::invalid;
+
+    for ( ; _steps.size() != _step; ++_step )
+    {
+        const Step & step = _steps[ _step ];
+        if ( !_begun )
+        {
+            if ( !_begin( step ) )
+            {
+                _invalid = true;
+                return Status::invalid;
+            }
+            _begun = true;
+        }
+
+        const bool done = Step::Kind::field == step.kind || Step::Kind::array == step.kind ?
+                          _elements( step, segment ) : _run( segment );
+        if ( !done ) return Status::incomplete;
+        _begun = false;
+    }
+    return Status::complete;
+}
+
+void IncrementalDecoder::reset()
+{
+    _step = 0;
+    _begun = false;
+    _invalid = false;
+    _staged = 0;
+    _consumed = 0;
+}
+
+bool IncrementalDecoder::_begin( const Step & step )
+{
+    _progress = 0;
+    _staged = 0;
+    _pRun = nullptr;
+    switch ( step.kind )
+    {
+        case Step::Kind::field:
+            _total = 1;
+            break;
+        case Step::Kind::fixedBytes:
+            _total = step.fixedLength;
+            _pRun = static_cast< unsigned char * >( step.pDest );
+            break;
+        case Step::Kind::skip:
+            _total = step.fixedLength;
+            break;
+        case Step::Kind::vectorBytes:
+        case Step::Kind::array:
+            _total = step.readCount( step.pCount );
+            if ( step.maxCount < _total ) return false;
+            _pRun = step.resize( step.pDest, _total );
+            break;
+    }
+    return true;
+}
+
+bool IncrementalDecoder::_elements( const Step & step, ByteStreambuf & segment )
+{
+    const size_t size = step.elementSize;
+    while ( _total != _progress )
+    {
+        const size_t avail = available( segment );
+
+        // An element straddling segments is staged until the rest of it arrives.
+        if ( 0 != _staged || avail < size )
+        {
+            const size_t n = std::min( size - _staged, avail );
+            if ( 0 == n ) return false;
+            std::memcpy( _staging + _staged, segment.claimGetBytes( n ), n );
+            _staged += n;
+            _consumed += n;
+            if ( size != _staged ) return false;
+            step.store( step.pDest, _progress++, _staging, 1 );
+            _staged = 0;
+            continue;
+        }
+
+        // Otherwise, every whole element the segment holds is decoded in place.
+        const size_t n = std::min( avail / size, _total - _progress );
+        step.store( step.pDest, _progress, segment.claimGetBytes( n * size ), n );
+        _progress += n;
+        _consumed += n * size;
+    }
+    return true;
+}
+
+bool IncrementalDecoder::_run( ByteStreambuf & segment )
+{
+    while ( _total != _progress )
+    {
+        const size_t n = std::min( available( segment ), _total - _progress );
+        if ( 0 == n ) return false;
+        const unsigned char * pBytes = segment.claimGetBytes( n );
+        if ( _pRun ) std::memcpy( _pRun + _progress, pBytes, n );
+        _progress += n;
+        _consumed += n;
+    }
+    return true;
+}
@@ -0,0 +1,253 @@
+/**
+* @file IncrementalDecoder.h
+* @brief The Specification for a Resumable Decoder of Messages Received in Segments
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_INCREMENTALDECODER_H
+#define REISERRT_BYTESTREAMBUF_INCREMENTALDECODER_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Incremental Decoder
+        *
+        * This class decodes a message which arrives in segments, as from a TCP stream or chunked input, without
+        * restarting when a segment ends part way through it. The message layout is described once, as a sequence
+        * of network ordered fields, fixed length byte runs and arrays whose lengths were decoded by earlier fields.
+        * Each segment is then handed to decode, which proceeds from where the previous segment left off. A field
+        * straddling two segments is staged internally until its remaining bytes arrive. The cost of decoding is
+        * proportional to the bytes received, however many segments they arrive in.
+        *
+        * Decoding is a state machine. The state is the step reached and the progress within it. Fields are written
+        * to their destinations as each completes, so destinations must outlive the decoder and must not move.
+        *
+        * @code IncrementalDecoder decoder;
+        * @code decoder.field( header.type ).field( header.count ).array( samples, header.count, 4096 );
+        * @code while ( IncrementalDecoder::Status::incomplete == decoder.decode( nextSegment() ) ) {}
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT IncrementalDecoder
+        {
+        public:
+            /**
+            * @brief Decode Status
+            */
+            enum class Status
+            {
+                complete,       //!< Every step has been decoded. Bytes beyond the message remain in the segment.
+                incomplete,     //!< The segment was consumed part way through the message.
+                invalid         //!< A length exceeded its maximum. Decoding cannot proceed until reset.
+            };
+
+            /**
+            * @brief Constructor for IncrementalDecoder
+            *
+            * The decoder begins with no steps.
+            */
+            IncrementalDecoder() = default;
+
+            IncrementalDecoder( const IncrementalDecoder & ) = delete;
+            IncrementalDecoder & operator=( const IncrementalDecoder & ) = delete;
+
+            /**
+            * @brief Add a Field Step
+            *
+            * @tparam T The type of the field. It must be a numeric or enumerator type.
+            * @param t The destination of the field.
+            * @return Returns this decoder, so that steps may be chained.
+            */
+            template < typename T >
+            IncrementalDecoder & field( T & t )
+            {
+                static_assert( std::is_integral<T>::value || std::is_floating_point<T>::value || std::is_enum<T>::value,
+                               "Type T must be an integer, floating point or enumerator type" );
+                static_assert( sizeof( T ) <= stagingSize, "Type T is too large to be staged" );
+                Step step{};
+                step.kind = Step::Kind::field;
+                step.pDest = &t;
+                step.elementSize = sizeof( T );
+                step.store = &_store< T >;
+                _steps.push_back( step );
+                return *this;
+            }
+
+            /**
+            * @brief Add a Fixed Length Byte Run Step
+            *
+            * @param pBytes The destination of the bytes.
+            * @param len The number of bytes.
+            * @return Returns this decoder, so that steps may be chained.
+            */
+            IncrementalDecoder & bytes( unsigned char * pBytes, size_t len );
+
+            /**
+            * @brief Add a Variable Length Byte Run Step
+            *
+            * The vector is resized to the count when the step is reached.
+            *
+            * @tparam CountT The type of the count. It must be an integer type.
+            * @param bytes The destination of the bytes.
+            * @param count The number of bytes, typically the destination of an earlier field step.
+            * @param maxCount The largest count accepted. A larger count makes the message invalid.
+            * @return Returns this decoder, so that steps may be chained.
+            */
+            template < typename CountT >
+            IncrementalDecoder & bytes( std::vector< unsigned char > & bytes, const CountT & count, size_t maxCount )
+            {
+                static_assert( std::is_integral<CountT>::value, "Type CountT must be an integer type" );
+                Step step{};
+                step.kind = Step::Kind::vectorBytes;
+                step.pDest = &bytes;
+                step.elementSize = 1;
+                step.pCount = &count;
+                step.readCount = &_readCount< CountT >;
+                step.maxCount = maxCount;
+                step.resize = &_resize< unsigned char >;
+                _steps.push_back( step );
+                return *this;
+            }
+
+            /**
+            * @brief Add an Array Step
+            *
+            * The vector is resized to the count when the step is reached, and each element decoded as a field.
+            *
+            * @tparam T The type of the elements. It must be a numeric or enumerator type.
+            * @tparam CountT The type of the count. It must be an integer type.
+            * @param elements The destination of the elements.
+            * @param count The number of elements, typically the destination of an earlier field step.
+            * @param maxCount The largest count accepted. A larger count makes the message invalid.
+            * @return Returns this decoder, so that steps may be chained.
+            */
+            template < typename T, typename CountT >
+            IncrementalDecoder & array( std::vector< T > & elements, const CountT & count, size_t maxCount )
+            {
+                static_assert( std::is_integral<T>::value || std::is_floating_point<T>::value || std::is_enum<T>::value,
+                               "Type T must be an integer, floating point or enumerator type" );
+                static_assert( sizeof( T ) <= stagingSize, "Type T is too large to be staged" );
+                static_assert( std::is_integral<CountT>::value, "Type CountT must be an integer type" );
+                Step step{};
+                step.kind = Step::Kind::array;
+                step.pDest = &elements;
+                step.elementSize = sizeof( T );
+                step.store = &_storeElements< T >;
+                step.pCount = &count;
+                step.readCount = &_readCount< CountT >;
+                step.maxCount = maxCount;
+                step.resize = &_resize< T >;
+                _steps.push_back( step );
+                return *this;
+            }
+
+            /**
+            * @brief Add a Skip Step
+            *
+            * @param len The number of bytes to skip.
+            * @return Returns this decoder, so that steps may be chained.
+            */
+            IncrementalDecoder & skip( size_t len );
+
+            /**
+            * @brief Decode a Segment
+            *
+            * Proceeds from where the previous segment left off, consuming from the get area of the segment until the
+            * message is complete or the segment is exhausted.
+            *
+            * @param segment The ByteStreambuf whose get area holds the next bytes received.
+            * @return Returns the status of the message.
+            */
+            Status decode( ByteStreambuf & segment );
+
+            /**
+            * @brief Reset
+            *
+            * Returns to the first step, so that the next message may be decoded. The steps are retained.
+            */
+            void reset();
+
+            /**
+            * @brief Bytes Consumed
+            *
+            * @return Returns the number of bytes of the current message consumed so far.
+            */
+            size_t consumed() const { return _consumed; }
+
+        private:
+            struct Step
+            {
+                enum class Kind { field, fixedBytes, vectorBytes, array, skip };
+
+                Kind kind;
+                void * pDest;
+                size_t elementSize;
+                size_t fixedLength;
+                void ( * store )( void * pDest, size_t index, const unsigned char * pBytes, size_t n );
+                const void * pCount;
+                size_t ( * readCount )( const void * pCount );
+                size_t maxCount;
+                unsigned char * ( * resize )( void * pVector, size_t n );
+            };
+
+            template < typename T >
+            static void _store( void * pDest, size_t, const unsigned char * pBytes, size_t )
+            {
+                *static_cast< T * >( pDest ) = _loadNetOrder< T >( pBytes );
+            }
+
+            template < typename T >
+            static void _storeElements( void * pDest, size_t index, const unsigned char * pBytes, size_t n )
+            {
+                T * pElements = &( *static_cast< std::vector< T > * >( pDest ) )[ index ];
+                for ( size_t i = 0; n != i; ++i, pBytes += sizeof( T ) )
+                    pElements[ i ] = _loadNetOrder< T >( pBytes );
+            }
+
+            template < typename CountT >
+            static size_t _readCount( const void * pCount )
+            {
+                const CountT count = *static_cast< const CountT * >( pCount );
+                return count < CountT( 0 ) ? ~size_t( 0 ) : size_t( count );
+            }
+
+            template < typename T >
+            static unsigned char * _resize( void * pVector, size_t n )
+            {
+                auto & elements = *static_cast< std::vector< T > * >( pVector );
+                elements.resize( n );
+                return n ? reinterpret_cast< unsigned char * >( &elements[0] ) : nullptr;
+            }
+
+            static constexpr size_t stagingSize = 16;
+
+            bool _begin( const Step & step );
+            bool _elements( const Step & step, ByteStreambuf & segment );
+            bool _run( ByteStreambuf & segment );
+
+            std::vector< Step > _steps;
+            size_t _step{ 0 };
+            bool _begun{ false };
+            bool _invalid{ false };
+            size_t _total{ 0 };
+            size_t _progress{ 0 };
+            unsigned char * _pRun{ nullptr };
+            size_t _staged{ 0 };
+            unsigned char _staging[ stagingSize ]{};   // Holds the bytes received so far of an element straddling segments.
+            size_t _consumed{ 0 };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_INCREMENTALDECODER_H
@@ -0,0 +1,224 @@
+/**
+* @file LzBlockCodec.cpp
+* @brief The Implementation for a Self Contained LZ Style Block Compression Codec
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "LzBlockCodec.h"
+
+#include <cstdint>
+#include <cstring>
+#include <endian.h>
+
+using namespace ReiserRT::Utility;
+
+constexpr size_t LzBlockCodec::errorSize;
+
+namespace
+{
+    constexpr size_t minMatch = 4;          // Shortest match encoded.
+    constexpr size_t lastLiterals = 5;      // The final bytes of a block are always literals.
+    constexpr size_t matchSearchLimit = 12; // No match may begin within this many bytes of the end.
+    constexpr size_t maxOffset = 65535;
+    constexpr unsigned hashBits = 12;
+
+    uint32_t read32( const unsigned char * p )
+    {
+        uint32_t v;
+        memcpy( &v, p, sizeof( v ) );
+        return v;
+    }
+
+    uint64_t read64( const unsigned char * p )
+    {
+        uint64_t v;
+        memcpy( &v, p, sizeof( v ) );
+        return v;
+    }
+
+    // The number of leading bytes, in memory order, which are equal given the XOR of two 64-bit reads.
+    size_t equalBytes( uint64_t diff )
+    {
+#if ( __BYTE_ORDER == __LITTLE_ENDIAN )
+        return size_t( __builtin_ctzll( diff ) ) >> 3;
+#else
+        return size_t( __builtin_clzll( diff ) ) >> 3;
+#endif
+    }
+
+    // Extend a match beyond its first minMatch bytes, a word at a time, not reaching matchLimit.
+    size_t extendMatch( const unsigned char * pSrc, size_t ip, size_t ref, size_t matchLimit )
+    {
+        size_t matchLen = minMatch;
+        while ( ip + matchLen + sizeof( uint64_t ) <= matchLimit )
+        {
+            const uint64_t diff = read64( pSrc + ip + matchLen ) ^ read64( pSrc + ref + matchLen );
+            if ( diff ) return matchLen + equalBytes( diff );
+            matchLen += sizeof( uint64_t );
+        }
+        while ( ip + matchLen < matchLimit && pSrc[ ref + matchLen ] == pSrc[ ip + matchLen ] )
+            ++matchLen;
+        return matchLen;
+    }
+
+    uint32_t hash32( uint32_t v )
+    {
+        return ( v * 2654435761U ) >> ( 32 - hashBits );
+    }
+
+    // Bytes needed to extend a length beyond the 15 a token nibble holds.
+    size_t lengthExtensionSize( size_t len )
+    {
+        return 15 > len ? 0 : ( len - 15 ) / 255 + 1;
+    }
+
+    unsigned char * writeLengthExtension( unsigned char * p, size_t len )
+    {
+        for ( len -= 15; 255 <= len; len -= 255 )
+            *p++ = 255;
+        *p++ = (unsigned char)len;
+        return p;
+    }
+
+    // Emit one sequence. A match length of zero emits the final, literals only, sequence.
+    // Returns nullptr if it would not fit.
+    unsigned char * emitSequence( unsigned char * p, unsigned char * pEnd,
+                                  const unsigned char * pLiterals, size_t literalLen,
+                                  size_t offset, size_t matchLen )
+    {
+        const size_t matchCode = matchLen ? matchLen - minMatch : 0;
+        const size_t needed = 1 + lengthExtensionSize( literalLen ) + literalLen +
+                              ( matchLen ? 2 + lengthExtensionSize( matchCode ) : 0 );
+        if ( size_t( pEnd - p ) < needed ) return nullptr;
+
+        unsigned char * pToken = p++;
+        *pToken = (unsigned char)( ( 15 > literalLen ? literalLen : 15 ) << 4 );
+        if ( 15 <= literalLen ) p = writeLengthExtension( p, literalLen );
+        if ( 0 != literalLen ) memcpy( p, pLiterals, literalLen );
+        p += literalLen;
+
+        if ( matchLen )
+        {
+            *p++ = (unsigned char)( offset & 0xFF );
+            *p++ = (unsigned char)( offset >> 8 );
+            *pToken |= (unsigned char)( 15 > matchCode ? matchCode : 15 );
+            if ( 15 <= matchCode ) p = writeLengthExtension( p, matchCode );
+        }
+        return p;
+    }
+
+    // Read a length extension. Returns false if it runs past the end of the input or overflows.
+    bool readLengthExtension( const unsigned char *& p, const unsigned char * pEnd, size_t & len )
+    {
+        unsigned char byte;
+        do {
+            if ( p == pEnd ) return false;
+            byte = *p++;
+            if ( len > ~size_t( 0 ) - byte ) return false;
+            len += byte;
+        } while ( 255 == byte );
+        return true;
+    }
+}
+
+size_t LzBlockCodec::compress( const unsigned char * pSrc, size_t srcLen, unsigned char * pDst, size_t dstCapacity )
+{
+    unsigned char * p = pDst;
+    unsigned char * const pEnd = pDst + dstCapacity;
+    size_t anchor = 0;
+
+    if ( matchSearchLimit < srcLen )
+    {
+        uint32_t table[ size_t( 1 ) << hashBits ] = {};
+        const size_t searchLimit = srcLen - matchSearchLimit;
+        const size_t matchLimit = srcLen - lastLiterals;
+
+        size_t ip = 0;
+        while ( ip < searchLimit )
+        {
+            const uint32_t v = read32( pSrc + ip );
+            const uint32_t h = hash32( v );
+            const size_t ref = table[ h ];
+            table[ h ] = uint32_t( ip );
+
+            if ( ref < ip && maxOffset >= ip - ref && read32( pSrc + ref ) == v )
+            {
+                const size_t matchLen = extendMatch( pSrc, ip, ref, matchLimit );
+
+                p = emitSequence( p, pEnd, pSrc + anchor, ip - anchor, ip - ref, matchLen );
+                if ( !p ) return 0;
+                ip += matchLen;
+                anchor = ip;
+            }
+            else
+            {
+                // Skip ahead faster through data which is not compressing.
+                ip += 1 + ( ( ip - anchor ) >> 6 );
+            }
+        }
+    }
+
+    p = emitSequence( p, pEnd, pSrc + anchor, srcLen - anchor, 0, 0 );
+    return p ? size_t( p - pDst ) : 0;
+}
+
+size_t LzBlockCodec::decompress( const unsigned char * pSrc, size_t srcLen, unsigned char * pDst, size_t dstCapacity )
+{
+    const unsigned char * p = pSrc;
+    const unsigned char * const pEnd = pSrc + srcLen;
+    unsigned char * op = pDst;
+    unsigned char * const opEnd = pDst + dstCapacity;
+
+    while ( p != pEnd )
+    {
+        const unsigned char token = *p++;
+
+        size_t literalLen = token >> 4;
+        if ( 15 == literalLen && !readLengthExtension( p, pEnd, literalLen ) ) return errorSize;
+        if ( size_t( pEnd - p ) < literalLen || size_t( opEnd - op ) < literalLen ) return errorSize;
+
+        // Short literals are copied with a fixed size copy when there is slack on both sides.
+        if ( 16 >= literalLen && 16 <= pEnd - p && 16 <= opEnd - op )
+            memcpy( op, p, 16 );
+        else if ( 0 != literalLen )
+            memcpy( op, p, literalLen );
+        p += literalLen;
+        op += literalLen;
+
+        // The final sequence holds literals only.
+        if ( p == pEnd ) break;
+
+        if ( 2 > pEnd - p ) return errorSize;
+        const size_t offset = size_t( p[0] ) | ( size_t( p[1] ) << 8 );
+        p += 2;
+        if ( 0 == offset || size_t( op - pDst ) < offset ) return errorSize;
+
+        size_t matchLen = token & 0x0F;
+        if ( 15 == matchLen && !readLengthExtension( p, pEnd, matchLen ) ) return errorSize;
+        matchLen += minMatch;
+        if ( size_t( opEnd - op ) < matchLen ) return errorSize;
+
+        // Matches may overlap the bytes they produce, so copy forward byte by byte unless they cannot.
+        const unsigned char * pMatch = op - offset;
+        if ( sizeof( uint64_t ) <= offset && matchLen + sizeof( uint64_t ) <= size_t( opEnd - op ) )
+        {
+            // Word copies never read bytes not yet written when the offset is at least a word.
+            unsigned char * const opMatchEnd = op + matchLen;
+            while ( op < opMatchEnd )
+            {
+                memcpy( op, pMatch, sizeof( uint64_t ) );
+                op += sizeof( uint64_t );
+                pMatch += sizeof( uint64_t );
+            }
+            op = opMatchEnd;
+        }
+        else
+        {
+            for ( size_t i = 0; matchLen != i; ++i )
+                *op++ = *pMatch++;
+        }
+    }
+
+    return size_t( op - pDst );
+}
@@ -0,0 +1,75 @@
+/**
+* @file LzBlockCodec.h
+* @brief The Specification for a Self Contained LZ Style Block Compression Codec
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_LZBLOCKCODEC_H
+#define REISERRT_BYTESTREAMBUF_LZBLOCKCODEC_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief LZ Style Block Compression Codec
+        *
+        * This class provides a fast, dependency free, LZ77 family block codec in the style of LZ4.
+        * A compressed block is a series of sequences. Each sequence is a token byte holding a 4-bit literal
+        * length and a 4-bit match length, optional length extension bytes, the literals, and a 2-byte little endian
+        * match offset of at most 65535 bytes. The final sequence holds literals only.
+        * Compression favors speed over ratio, using a single probe hash table of 4-byte sequences.
+        *
+        * The format is self consistent only. No claim of interoperability with other LZ4 implementations is made.
+        * Decompression fully validates its input and never reads or writes outside the buffers provided.
+        */
+        class ReiserRT_ByteStreambuf_EXPORT LzBlockCodec
+        {
+        public:
+            /**
+            * @brief Error Return Value
+            *
+            * The value returned by decompress when the compressed block is malformed or does not fit.
+            */
+            static constexpr size_t errorSize = ~size_t( 0 );
+
+            /**
+            * @brief Compressed Size Bound
+            *
+            * @param len The length of the uncompressed block.
+            * @return Returns the largest compressed size a block of length len may produce.
+            */
+            static size_t compressBound( size_t len ) { return len + len / 255 + 16; }
+
+            /**
+            * @brief Compress a Block
+            *
+            * @param pSrc A pointer to the uncompressed block.
+            * @param srcLen The length of the uncompressed block.
+            * @param pDst A pointer to where the compressed block is to be written.
+            * @param dstCapacity The capacity of the destination. A capacity of compressBound( srcLen ) always suffices.
+            * @return Returns the length of the compressed block or zero if it would not fit within dstCapacity.
+            */
+            static size_t compress( const unsigned char * pSrc, size_t srcLen, unsigned char * pDst, size_t dstCapacity );
+
+            /**
+            * @brief Decompress a Block
+            *
+            * @param pSrc A pointer to the compressed block.
+            * @param srcLen The length of the compressed block.
+            * @param pDst A pointer to where the uncompressed block is to be written.
+            * @param dstCapacity The capacity of the destination.
+            * @return Returns the length of the uncompressed block or errorSize if the compressed block is malformed
+            * or would not fit within dstCapacity.
+            */
+            static size_t decompress( const unsigned char * pSrc, size_t srcLen, unsigned char * pDst, size_t dstCapacity );
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_LZBLOCKCODEC_H
@@ -0,0 +1,86 @@
+/**
+* @file MessageCoalescer.cpp
+* @brief The Implementation for an MTU Aware Writer Coalescing Small Messages into Datagrams
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "MessageCoalescer.h"
+#include "Serialization.h"
+
+#include <cstring>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+constexpr size_t CoalescedDatagramFormat::lengthPrefixSize;
+constexpr size_t CoalescedDatagramFormat::maxMessageSize;
+
+MessageCoalescer::MessageCoalescer( FlushHandler flushHandler, size_t capacity, size_t flushThreshold,
+                                    std::chrono::microseconds maxDelay )
+  : _flushHandler( std::move( flushHandler ) )
+  , _datagram( CoalescedDatagramFormat::lengthPrefixSize < capacity ? capacity :
+               CoalescedDatagramFormat::lengthPrefixSize + 1 )
+  , _message( _datagram.data(), 0, std::ios_base::out )
+  , _flushThreshold( 0 == flushThreshold || flushThreshold > _datagram.size() ? _datagram.size() : flushThreshold )
+  , _maxDelay( maxDelay )
+{
+}
+
+ByteStreambuf * MessageCoalescer::reserve( size_t maxLen )
+{
+    _reserved = false;
+    const size_t needed = CoalescedDatagramFormat::lengthPrefixSize + maxLen;
+    if ( CoalescedDatagramFormat::maxMessageSize < maxLen || _datagram.size() < needed ) return nullptr;
+
+    if ( _datagram.size() - _used < needed ) flush();
+    _reserved = true;
+
+    // The room offered is all that remains, even if more than maxLen, but no more than a length prefix describes.
+    size_t room = _datagram.size() - _used - CoalescedDatagramFormat::lengthPrefixSize;
+    if ( CoalescedDatagramFormat::maxMessageSize < room ) room = CoalescedDatagramFormat::maxMessageSize;
+    _message.pubsetbuf( _datagram.data() + _used + CoalescedDatagramFormat::lengthPrefixSize,
+                        std::streamsize( room ) );
+    return &_message;
+}
+
+void MessageCoalescer::commit()
+{
+    if ( !_reserved ) return;
+    _reserved = false;
+
+    const size_t len = size_t( _message.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) );
+    _storeNetOrder( _datagram.data() + _used, uint16_t( len ) );
+    if ( 0 == _numMessages ) _firstCommitTime = std::chrono::steady_clock::now();
+    _used += CoalescedDatagramFormat::lengthPrefixSize + len;
+    ++_numMessages;
+
+    if ( _flushThreshold <= _used ) flush();
+    else poll();
+}
+
+bool MessageCoalescer::append( const unsigned char * pMessage, size_t len )
+{
+    ByteStreambuf * pByteStreambuf = reserve( len );
+    if ( !pByteStreambuf ) return false;
+    if ( len ) memcpy( pByteStreambuf->claimPutBytes( len ), pMessage, len );
+    commit();
+    return true;
+}
+
+void MessageCoalescer::poll()
+{
+    if ( 0 != _numMessages && 0 != _maxDelay.count() &&
+         std::chrono::steady_clock::now() - _firstCommitTime >= _maxDelay )
+        flush();
+}
+
+void MessageCoalescer::flush()
+{
+    _reserved = false;
+    if ( 0 == _numMessages ) return;
+
+    _flushHandler( _datagram.data(), _used );
+    _used = 0;
+    _numMessages = 0;
+}
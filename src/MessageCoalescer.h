@@ -0,0 +1,159 @@
+/**
+* @file MessageCoalescer.h
+* @brief The Specification for an MTU Aware Writer Coalescing Small Messages into Datagrams
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_MESSAGECOALESCER_H
+#define REISERRT_BYTESTREAMBUF_MESSAGECOALESCER_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreambuf.h"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Coalesced Datagram Format Constants
+        *
+        * A coalesced datagram is a series of messages, each preceded by its length as a 16-bit network ordered value.
+        */
+        struct CoalescedDatagramFormat
+        {
+            static constexpr size_t lengthPrefixSize = 2;       //!< Size of each message's length prefix.
+            static constexpr size_t maxMessageSize = 65535;     //!< Largest message a length prefix can describe.
+        };
+
+        /**
+        * @brief MTU Aware Message Coalescing Writer
+        *
+        * This class packs small, length delimited messages into a single datagram sized buffer which it owns.
+        * A message is serialized in place into the ByteStreambuf returned by reserve, then committed. The buffer is
+        * handed to the flush handler, for instance to send it as one datagram, when the next message would not fit,
+        * when a commit brings it to the flush threshold, when the oldest message in it has waited the maximum delay,
+        * or upon an explicit flush. Time is only examined upon commit and poll. Call poll periodically to honor
+        * the maximum delay when messages are infrequent.
+        *
+        * DatagramSplitter iterates the messages of a coalesced datagram upon receipt.
+        *
+        * @code MessageCoalescer coalescer( sendDatagram );
+        * @code ByteStreambuf * pMessage = coalescer.reserve( 64 );
+        * @code typeToNet( sequence, *pMessage );
+        * @code coalescer.commit();
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT MessageCoalescer
+        {
+        public:
+            /**
+            * @brief Flush Handler Type
+            *
+            * Invoked with the address and length of a coalesced datagram. The memory is reused once it returns.
+            */
+            using FlushHandler = std::function< void( const unsigned char *, size_t ) >;
+
+            /**
+            * @brief Constructor for MessageCoalescer
+            *
+            * @param flushHandler The handler invoked with each coalesced datagram.
+            * @param capacity The datagram capacity. The default suits an Ethernet MTU after IPv4 and UDP headers.
+            * @param flushThreshold A commit bringing the datagram to this many bytes flushes it.
+            * Zero means the capacity.
+            * @param maxDelay The longest the first message in a datagram may wait. Zero means no limit.
+            */
+            explicit MessageCoalescer( FlushHandler flushHandler, size_t capacity = 1472, size_t flushThreshold = 0,
+                                       std::chrono::microseconds maxDelay = std::chrono::microseconds( 0 ) );
+
+            /**
+            * @brief Destructor for MessageCoalescer
+            *
+            * Any committed messages are not flushed. Flush first if they are wanted.
+            */
+            ~MessageCoalescer() = default;
+
+            MessageCoalescer( const MessageCoalescer & ) = delete;
+            MessageCoalescer & operator=( const MessageCoalescer & ) = delete;
+
+            /**
+            * @brief Reserve Room for a Message
+            *
+            * Flushes first if a message of up to maxLen bytes would not fit. A previous reservation not committed
+            * is abandoned.
+            *
+            * @param maxLen The most bytes the message may take.
+            * @return Returns a ByteStreambuf opened for output over the room reserved, or nullptr if maxLen exceeds
+            * what a datagram or length prefix can hold.
+            */
+            ByteStreambuf * reserve( size_t maxLen );
+
+            /**
+            * @brief Commit the Reserved Message
+            *
+            * The message length is the put position of the ByteStreambuf returned by reserve.
+            * A zero length message is committed as such.
+            */
+            void commit();
+
+            /**
+            * @brief Append a Message
+            *
+            * Copies a message already serialized elsewhere, reserving and committing it.
+            *
+            * @param pMessage The message.
+            * @param len The length of the message.
+            * @return Returns false if the message exceeds what a datagram or length prefix can hold.
+            */
+            bool append( const unsigned char * pMessage, size_t len );
+
+            /**
+            * @brief Poll the Maximum Delay
+            *
+            * Flushes if the first message in the datagram has waited the maximum delay.
+            */
+            void poll();
+
+            /**
+            * @brief Flush
+            *
+            * Hands any committed messages to the flush handler. A reservation not committed is abandoned.
+            * The flush handler must not use this object.
+            */
+            void flush();
+
+            /**
+            * @brief Pending Bytes
+            *
+            * @return Returns the number of bytes committed, including length prefixes, but not flushed.
+            */
+            size_t pendingBytes() const { return _used; }
+
+            /**
+            * @brief Pending Messages
+            *
+            * @return Returns the number of messages committed but not flushed.
+            */
+            size_t pendingMessages() const { return _numMessages; }
+
+        private:
+            FlushHandler _flushHandler;
+            std::vector< unsigned char > _datagram;
+            ByteStreambuf _message;
+            const size_t _flushThreshold;
+            const std::chrono::microseconds _maxDelay;
+            std::chrono::steady_clock::time_point _firstCommitTime;
+            size_t _used{ 0 };
+            size_t _numMessages{ 0 };
+            bool _reserved{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_MESSAGECOALESCER_H
@@ -0,0 +1,164 @@
+/**
+* @file MessageTemplate.h
+* @brief Prebuilt Message Templates with In Place Field Patching upon a ByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_MESSAGETEMPLATE_H
+#define REISERRT_BYTESTREAMBUF_MESSAGETEMPLATE_H
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+
+#include <vector>
+#include <cstring>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Prebuilt Message Template
+        *
+        * This class holds the network ordered image of a message whose fields are mostly constant.
+        * The image is built once by appending constants and variable fields in order. Appending a variable field
+        * returns a typed handle recording its offset, its width being that of its type. Each message is then
+        * encoded by writing the image into a ByteStreambuf's put area, a single memcpy, and patching only
+        * the variable fields in network order.
+        *
+        * @code MessageTemplate heartbeat;
+        * @code heartbeat.appendConstant( uint16_t( 0x4842 ) );
+        * @code auto sequenceField = heartbeat.appendField< uint32_t >();
+        * @code unsigned char * pMessage = heartbeat.write( byteStreambuf );
+        * @code if ( pMessage ) MessageTemplate::patch( pMessage, sequenceField, sequence );
+        * @endcode
+        */
+        class MessageTemplate
+        {
+        public:
+            /**
+            * @brief Variable Field Handle
+            *
+            * @tparam T The type of the field. Its width is sizeof( T ).
+            */
+            template < typename T >
+            class Field
+            {
+            public:
+                /**
+                * @brief Field Offset
+                *
+                * @return Returns the offset of the field from the start of the message.
+                */
+                size_t offset() const { return _offset; }
+
+                /**
+                * @brief Field Width
+                *
+                * @return Returns the width of the field in bytes.
+                */
+                static constexpr size_t width() { return sizeof( T ); }
+
+            private:
+                friend class MessageTemplate;
+                explicit Field( size_t offset ) : _offset( offset ) {}
+
+                size_t _offset;
+            };
+
+            /**
+            * @brief Append a Constant
+            *
+            * @tparam T The type of the constant. It must be a numeric or enumerator type.
+            * @param value The constant, appended in network order.
+            */
+            template < typename T >
+            void appendConstant( const T & value )
+            {
+                _storeNetOrder< T >( _grow( sizeof( T ) ), value );
+            }
+
+            /**
+            * @brief Append Constant Bytes
+            *
+            * @param pBytes The bytes, appended as they are.
+            * @param len The number of bytes.
+            */
+            void appendBytes( const unsigned char * pBytes, size_t len )
+            {
+                if ( len ) memcpy( _grow( len ), pBytes, len );
+            }
+
+            /**
+            * @brief Append a Variable Field
+            *
+            * @tparam T The type of the field. It must be a numeric or enumerator type.
+            * @param initialValue The value held by the image, and so by messages where the field is not patched.
+            * @return Returns the handle with which the field is patched.
+            */
+            template < typename T >
+            Field< T > appendField( const T & initialValue = T() )
+            {
+                const Field< T > field( _image.size() );
+                appendConstant( initialValue );
+                return field;
+            }
+
+            /**
+            * @brief Message Size
+            *
+            * @return Returns the size in bytes of each message written.
+            */
+            size_t size() const { return _image.size(); }
+
+            /**
+            * @brief Message Image
+            *
+            * @return Returns a pointer to the network ordered image.
+            */
+            const unsigned char * data() const { return _image.data(); }
+
+            /**
+            * @brief Write a Message
+            *
+            * Copies the image into the ByteStreambuf put area, advancing the put position. This is all or nothing.
+            *
+            * @param byteStreambuf The ByteStreambuf to write to.
+            * @return Returns a pointer to the message written for patching, or nullptr if there was not room.
+            */
+            unsigned char * write( ByteStreambuf & byteStreambuf ) const
+            {
+                unsigned char * pMessage = byteStreambuf.claimPutBytes( _image.size() );
+                if ( pMessage && !_image.empty() ) memcpy( pMessage, _image.data(), _image.size() );
+                return pMessage;
+            }
+
+            /**
+            * @brief Patch a Variable Field
+            *
+            * @tparam T The type of the field.
+            * @param pMessage A pointer to a message written by this template.
+            * @param field The field handle.
+            * @param value The value, stored in network order.
+            */
+            template < typename T >
+            static void patch( unsigned char * pMessage, const Field< T > & field, const T & value )
+            {
+                _storeNetOrder< T >( pMessage + field.offset(), value );
+            }
+
+        private:
+            unsigned char * _grow( size_t len )
+            {
+                const size_t offset = _image.size();
+                _image.resize( offset + len );
+                return _image.data() + offset;
+            }
+
+            std::vector< unsigned char > _image;
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_MESSAGETEMPLATE_H
@@ -0,0 +1,107 @@
+/**
+* @file NetOrderTypes.h
+* @brief Network Ordered Overlay Types for In Place Decoding of ByteStreambuf Contents
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_NETORDERTYPES_H
+#define REISERRT_BYTESTREAMBUF_NETORDERTYPES_H
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+
+#include <type_traits>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Network Ordered Value
+        *
+        * This class template stores a value of type T as sizeof( T ) network ordered bytes. It has an alignment
+        * of one and no padding, so overlay structures composed of these need no packing pragmas. The value is
+        * converted only when accessed, so an overlay placed over a received message decodes just the fields touched.
+        *
+        * @tparam T The type of the value. It must be a numeric or enumerator type.
+        */
+        template < typename T >
+        class BigEndian
+        {
+        public:
+            /**
+            * @brief Get the Value
+            *
+            * @return Returns the value in host order.
+            */
+            T get() const { return _loadNetOrder< T >( _bytes ); }
+
+            /**
+            * @brief Conversion to the Value
+            *
+            * @return Returns the value in host order.
+            */
+            operator T() const { return get(); }
+
+            /**
+            * @brief Set the Value
+            *
+            * @param value The value in host order, stored in network order.
+            */
+            void set( const T & value ) { _storeNetOrder< T >( _bytes, value ); }
+
+            /**
+            * @brief Assignment from the Value
+            *
+            * @param value The value in host order, stored in network order.
+            * @return Returns a reference to this object.
+            */
+            BigEndian & operator=( const T & value ) { set( value ); return *this; }
+
+        private:
+            unsigned char _bytes[ sizeof( T ) ];
+        };
+
+        using be_uint8 = BigEndian< uint8_t >;      //!< Network ordered uint8_t.
+        using be_int8 = BigEndian< int8_t >;        //!< Network ordered int8_t.
+        using be_uint16 = BigEndian< uint16_t >;    //!< Network ordered uint16_t.
+        using be_int16 = BigEndian< int16_t >;      //!< Network ordered int16_t.
+        using be_uint32 = BigEndian< uint32_t >;    //!< Network ordered uint32_t.
+        using be_int32 = BigEndian< int32_t >;      //!< Network ordered int32_t.
+        using be_uint64 = BigEndian< uint64_t >;    //!< Network ordered uint64_t.
+        using be_int64 = BigEndian< int64_t >;      //!< Network ordered int64_t.
+        using be_float32 = BigEndian< float >;      //!< Network ordered float.
+        using be_float64 = BigEndian< double >;     //!< Network ordered double.
+
+        static_assert( 1 == alignof( be_float64 ) && sizeof( double ) == sizeof( be_float64 ),
+                       "BigEndian must have an alignment of one and no padding" );
+
+        /**
+        * @brief View an Overlay at an Offset
+        *
+        * This template operation validates that an overlay structure of network ordered types lies wholly within
+        * the ByteStreambuf get area at the offset given, and returns a pointer through which it may be read
+        * in place. The get position is not affected.
+        *
+        * @tparam Overlay The overlay structure. It must be standard layout with an alignment of one,
+        * as is any structure composed of BigEndian members and unsigned char arrays.
+        * @param byteStreambuf The ByteStreambuf whose get area holds the bytes.
+        * @param offset The offset of the overlay from the start of the get area.
+        * @return Returns a pointer to the overlay, or nullptr if it does not fit.
+        */
+        template < typename Overlay >
+        const Overlay * viewAt( const ByteStreambuf & byteStreambuf, size_t offset )
+        {
+            static_assert( std::is_standard_layout< Overlay >::value && 1 == alignof( Overlay ),
+                           "Overlay must be standard layout with an alignment of one" );
+            const unsigned char * const pBegin = byteStreambuf.getAreaBegin();
+            const size_t len = size_t( byteStreambuf.getAreaEnd() - pBegin );
+            if ( offset > len || sizeof( Overlay ) > len - offset ) return nullptr;
+            return reinterpret_cast< const Overlay * >( pBegin + offset );
+        }
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_NETORDERTYPES_H
@@ -0,0 +1,114 @@
+/**
+* @file ParallelSerializer.cpp
+* @brief The Implementation for Serializing Records Concurrently into Disjoint Regions of One Buffer
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ParallelSerializer.h"
+#include "ByteStreambuf.h"
+
+#include <algorithm>
+#include <exception>
+#include <system_error>
+#include <thread>
+
+using namespace ReiserRT::Utility;
+
+ParallelSerializer::ParallelSerializer( unsigned numThreads )
+  : _numThreads( 0 != numThreads ? numThreads : std::max( 1U, std::thread::hardware_concurrency() ) )
+  , _offsets( 1, 0 )
+{
+}
+
+size_t ParallelSerializer::plan( size_t numRecords, const SizeFunction & sizeFunction )
+{
+    _offsets.assign( 1, 0 );
+    _offsets.reserve( numRecords + 1 );
+    for ( size_t i = 0; numRecords != i; ++i )
+        _offsets.push_back( _offsets.back() + sizeFunction( i ) );
+    return _offsets.back();
+}
+
+bool ParallelSerializer::serialize( ByteStreambuf & out, const WriteFunction & writeFunction )
+{
+    const size_t numRecords = _offsets.size() - 1;
+    const size_t total = _offsets.back();
+    const ByteStreambuf::Position pos = out.position();
+    unsigned char * pBlock = out.claimPutBytes( total );
+    if ( !pBlock ) return false;
+
+    // Partition the records into contiguous runs of roughly equal bytes.
+    const size_t numRuns = std::max( size_t( 1 ), std::min( size_t( _numThreads ), numRecords ) );
+    std::vector< size_t > firstRecords( numRuns + 1, numRecords );
+    firstRecords[0] = 0;
+    for ( size_t r = 1; numRuns != r; ++r )
+    {
+        const size_t target = total / numRuns * r + total % numRuns * r / numRuns;
+        const size_t first = size_t( std::lower_bound( _offsets.begin(), _offsets.end() - 1, target ) - _offsets.begin() );
+        firstRecords[r] = std::max( first, firstRecords[ r - 1 ] );
+    }
+
+    // Results are chars rather than a vector of bool, as each is written by a different thread.
+    std::vector< char > results( numRuns, 0 );
+    std::vector< std::exception_ptr > errors( numRuns );
+    auto serializeRun = [&]( size_t r )
+    {
+        try
+        {
+            results[r] = _serializeRun( pBlock, firstRecords[r], firstRecords[ r + 1 ], writeFunction );
+        }
+        catch ( ... )
+        {
+            errors[r] = std::current_exception();
+        }
+    };
+
+    // Should a thread not be available, its run is serialized by the calling thread instead.
+    std::vector< std::thread > threads;
+    threads.reserve( numRuns - 1 );
+    for ( size_t r = 1; numRuns != r; ++r )
+    {
+        try
+        {
+            threads.emplace_back( serializeRun, r );
+        }
+        catch ( const std::system_error & )
+        {
+            serializeRun( r );
+        }
+    }
+    serializeRun( 0 );
+    for ( auto & thread : threads ) thread.join();
+
+    // The earliest failing run's exception is rethrown, as serial serialization would have thrown it.
+    for ( const auto & error : errors )
+    {
+        if ( error )
+        {
+            out.restore( pos );
+            std::rethrow_exception( error );
+        }
+    }
+    if ( std::find( results.begin(), results.end(), 0 ) != results.end() )
+    {
+        out.restore( pos );
+        return false;
+    }
+    return true;
+}
+
+bool ParallelSerializer::_serializeRun( unsigned char * pBlock, size_t first, size_t last,
+                                        const WriteFunction & writeFunction ) const
+{
+    if ( first == last ) return true;
+
+    ByteStreambuf region{ pBlock + _offsets[ first ], std::streamsize( _offsets[ last ] - _offsets[ first ] ),
+                          std::ios_base::out };
+    for ( size_t i = first; last != i; ++i )
+    {
+        writeFunction( i, region );
+        if ( pBlock + _offsets[ i + 1 ] != region.position().pPut ) return false;
+    }
+    return true;
+}
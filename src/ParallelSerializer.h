@@ -0,0 +1,115 @@
+/**
+* @file ParallelSerializer.h
+* @brief The Specification for Serializing Records Concurrently into Disjoint Regions of One Buffer
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_PARALLELSERIALIZER_H
+#define REISERRT_BYTESTREAMBUF_PARALLELSERIALIZER_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        class ByteStreambuf;
+
+        /**
+        * @brief Parallel Serializer
+        *
+        * This class serializes a batch of records into one contiguous block using several threads, producing
+        * the same bytes serial serialization would. It works in two phases.
+        * @li Plan. The wire size of every record is computed, and a prefix sum of them gives each record's offset.
+        * @li Serialize. The records are partitioned into contiguous runs of roughly equal bytes. Each thread
+        * wraps its own ByteStreambuf around its run's disjoint region of the block and serializes the run's records
+        * into it in order. The calling thread takes one run itself.
+        *
+        * Every record must serialize to exactly the size planned. One that does not fails the batch.
+        *
+        * @code ParallelSerializer serializer( 4 );
+        * @code serializer.plan( records.size(), [&]( size_t i ) { return wireSize( records[i] ); } );
+        * @code serializer.serialize( byteStreambuf, [&]( size_t i, ByteStreambuf & region ) { write( records[i], region ); } );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT ParallelSerializer
+        {
+        public:
+            /**
+            * @brief Size Function Type
+            *
+            * Returns the wire size of the record at an index.
+            */
+            using SizeFunction = std::function< size_t( size_t ) >;
+
+            /**
+            * @brief Write Function Type
+            *
+            * Serializes the record at an index into a ByteStreambuf, at its put position. It is invoked concurrently
+            * for records of different runs.
+            */
+            using WriteFunction = std::function< void( size_t, ByteStreambuf & ) >;
+
+            /**
+            * @brief Constructor for ParallelSerializer
+            *
+            * @param numThreads The number of threads to serialize with, including the calling thread.
+            * Zero means the hardware concurrency.
+            */
+            explicit ParallelSerializer( unsigned numThreads = 0 );
+
+            /**
+            * @brief Plan a Batch
+            *
+            * Sizes every record and computes their offsets.
+            *
+            * @param numRecords The number of records in the batch.
+            * @param sizeFunction The function sizing each record.
+            * @return Returns the total size of the batch in bytes.
+            */
+            size_t plan( size_t numRecords, const SizeFunction & sizeFunction );
+
+            /**
+            * @brief Serialize the Planned Batch
+            *
+            * Claims the total size of the batch from the put area of the output and serializes the records into it
+            * concurrently. If write functions throw, the exception of the earliest run to fail, the one holding the
+            * lowest numbered records, is rethrown once every thread has finished, without advancing the put position.
+            * This is the exception serial serialization would have thrown, whichever thread threw first.
+            *
+            * @param out The ByteStreambuf whose put area is written.
+            * @param writeFunction The function serializing each record.
+            * @return Returns true if the batch was serialized. Returns false, without advancing the put position,
+            * if there is not room for the batch or a record did not serialize to the size planned.
+            */
+            bool serialize( ByteStreambuf & out, const WriteFunction & writeFunction );
+
+            /**
+            * @brief Record Offsets
+            *
+            * @return Returns the offset of each planned record within the batch, followed by the total size.
+            */
+            const std::vector< size_t > & offsets() const { return _offsets; }
+
+            /**
+            * @brief Thread Count
+            *
+            * @return Returns the number of threads serialization uses, including the calling thread.
+            */
+            unsigned numThreads() const { return _numThreads; }
+
+        private:
+            bool _serializeRun( unsigned char * pBlock, size_t first, size_t last, const WriteFunction & writeFunction ) const;
+
+            const unsigned _numThreads;
+            std::vector< size_t > _offsets;
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_PARALLELSERIALIZER_H
@@ -0,0 +1,336 @@
+/**
+* @file QuantizedFloat.cpp
+* @brief The Implementation for Quantized Float Array Serialization upon a ByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "QuantizedFloat.h"
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define REISERRT_BYTESTREAMBUF_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    uint32_t floatBits( float value )
+    {
+        uint32_t bits;
+        memcpy( &bits, &value, sizeof( bits ) );
+        return bits;
+    }
+
+    float bitsFloat( uint32_t bits )
+    {
+        float value;
+        memcpy( &value, &bits, sizeof( value ) );
+        return value;
+    }
+
+    // The integer range of each fixed point width, as floats. The upper limit for 4 bytes is the largest float
+    // below 2^31, since 2^31 itself does not convert.
+    bool fixedLimits( unsigned width, float & lo, float & hi )
+    {
+        switch ( width )
+        {
+            case 1: lo = -128.0f; hi = 127.0f; return true;
+            case 2: lo = -32768.0f; hi = 32767.0f; return true;
+            case 4: lo = -2147483648.0f; hi = 2147483520.0f; return true;
+            default: return false;
+        }
+    }
+
+    int32_t quantize( float value, float scale, float lo, float hi )
+    {
+        float x = value * scale;
+        if ( x != x ) x = 0.0f;
+        x = x < lo ? lo : ( x > hi ? hi : x );
+        return int32_t( std::nearbyint( x ) );
+    }
+
+    void fixedToNetScalar( const float * pValues, size_t count, float scale, unsigned width, unsigned char * pBytes )
+    {
+        float lo, hi;
+        fixedLimits( width, lo, hi );
+        for ( size_t i = 0; count != i; ++i, pBytes += width )
+        {
+            const int32_t v = quantize( pValues[i], scale, lo, hi );
+            if ( 1 == width ) _storeNetOrder( pBytes, int8_t( v ) );
+            else if ( 2 == width ) _storeNetOrder( pBytes, int16_t( v ) );
+            else _storeNetOrder( pBytes, v );
+        }
+    }
+
+    void netToFixedScalar( const unsigned char * pBytes, float * pValues, size_t count, float scale, unsigned width )
+    {
+        for ( size_t i = 0; count != i; ++i, pBytes += width )
+        {
+            int32_t v;
+            if ( 1 == width ) v = _loadNetOrder< int8_t >( pBytes );
+            else if ( 2 == width ) v = _loadNetOrder< int16_t >( pBytes );
+            else v = _loadNetOrder< int32_t >( pBytes );
+            pValues[i] = float( v ) / scale;
+        }
+    }
+
+    void halfToNetScalar( const float * pValues, size_t count, unsigned char * pBytes )
+    {
+        for ( size_t i = 0; count != i; ++i )
+            _storeNetOrder( pBytes + 2 * i, QuantizedFloat::floatToHalf( pValues[i] ) );
+    }
+
+    void netToHalfScalar( const unsigned char * pBytes, float * pValues, size_t count )
+    {
+        for ( size_t i = 0; count != i; ++i )
+            pValues[i] = QuantizedFloat::halfToFloat( _loadNetOrder< uint16_t >( pBytes + 2 * i ) );
+    }
+
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    bool hasF16c()
+    {
+        __builtin_cpu_init();
+        return 0 != __builtin_cpu_supports( "f16c" );
+    }
+
+    // F16C implies AVX and so SSSE3 byte shuffles. Eight values at a time, the remainder portably.
+    __attribute__(( target( "avx,f16c" ) ))
+    void halfToNetF16c( const float * pValues, size_t count, unsigned char * pBytes )
+    {
+        const __m128i swap16 = _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+        size_t i = 0;
+        for ( ; i + 8 <= count; i += 8 )
+        {
+            const __m128i halves = _mm256_cvtps_ph( _mm256_loadu_ps( pValues + i ), _MM_FROUND_TO_NEAREST_INT );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pBytes + 2 * i ), _mm_shuffle_epi8( halves, swap16 ) );
+        }
+        halfToNetScalar( pValues + i, count - i, pBytes + 2 * i );
+    }
+
+    __attribute__(( target( "avx,f16c" ) ))
+    void netToHalfF16c( const unsigned char * pBytes, float * pValues, size_t count )
+    {
+        const __m128i swap16 = _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+        size_t i = 0;
+        for ( ; i + 8 <= count; i += 8 )
+        {
+            const __m128i halves = _mm_loadu_si128( reinterpret_cast< const __m128i * >( pBytes + 2 * i ) );
+            _mm256_storeu_ps( pValues + i, _mm256_cvtph_ps( _mm_shuffle_epi8( halves, swap16 ) ) );
+        }
+        netToHalfScalar( pBytes + 2 * i, pValues + i, count - i );
+    }
+#endif
+
+#ifdef __SSE2__
+    __m128i byteSwap16( __m128i v )
+    {
+        return _mm_or_si128( _mm_slli_epi16( v, 8 ), _mm_srli_epi16( v, 8 ) );
+    }
+
+    __m128i byteSwap32( __m128i v )
+    {
+        v = byteSwap16( v );
+        return _mm_shufflelo_epi16( _mm_shufflehi_epi16( v, 0xB1 ), 0xB1 );
+    }
+
+    // Quantize four values as the scalar conversion does. NaN is zeroed before clamping.
+    __m128i quantize4( const float * pValues, __m128 scale, __m128 lo, __m128 hi )
+    {
+        __m128 x = _mm_mul_ps( _mm_loadu_ps( pValues ), scale );
+        x = _mm_and_ps( x, _mm_cmpord_ps( x, x ) );
+        x = _mm_min_ps( _mm_max_ps( x, lo ), hi );
+        return _mm_cvtps_epi32( x );
+    }
+
+    void fixedToNetSse2( const float * pValues, size_t count, float scale, unsigned width, unsigned char * pBytes )
+    {
+        float loScalar, hiScalar;
+        fixedLimits( width, loScalar, hiScalar );
+        const __m128 vScale = _mm_set1_ps( scale );
+        const __m128 lo = _mm_set1_ps( loScalar );
+        const __m128 hi = _mm_set1_ps( hiScalar );
+        const size_t perStore = 16 / width;
+
+        size_t i = 0;
+        for ( ; i + perStore <= count; i += perStore )
+        {
+            __m128i out;
+            if ( 4 == width )
+                out = byteSwap32( quantize4( pValues + i, vScale, lo, hi ) );
+            else if ( 2 == width )
+                out = byteSwap16( _mm_packs_epi32( quantize4( pValues + i, vScale, lo, hi ),
+                                                   quantize4( pValues + i + 4, vScale, lo, hi ) ) );
+            else
+                out = _mm_packs_epi16( _mm_packs_epi32( quantize4( pValues + i, vScale, lo, hi ),
+                                                        quantize4( pValues + i + 4, vScale, lo, hi ) ),
+                                       _mm_packs_epi32( quantize4( pValues + i + 8, vScale, lo, hi ),
+                                                        quantize4( pValues + i + 12, vScale, lo, hi ) ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pBytes + i * width ), out );
+        }
+        fixedToNetScalar( pValues + i, count - i, scale, width, pBytes + i * width );
+    }
+
+    void store4( float * pValues, __m128i v, __m128 scale )
+    {
+        _mm_storeu_ps( pValues, _mm_div_ps( _mm_cvtepi32_ps( v ), scale ) );
+    }
+
+    void netToFixedSse2( const unsigned char * pBytes, float * pValues, size_t count, float scale, unsigned width )
+    {
+        const __m128 vScale = _mm_set1_ps( scale );
+        const size_t perLoad = 16 / width;
+
+        size_t i = 0;
+        for ( ; i + perLoad <= count; i += perLoad )
+        {
+            const __m128i in = _mm_loadu_si128( reinterpret_cast< const __m128i * >( pBytes + i * width ) );
+            if ( 4 == width )
+                store4( pValues + i, byteSwap32( in ), vScale );
+            else if ( 2 == width )
+            {
+                // Sign extend by placing each 16-bit value in the upper half of a 32-bit lane.
+                const __m128i v = byteSwap16( in );
+                store4( pValues + i, _mm_srai_epi32( _mm_unpacklo_epi16( v, v ), 16 ), vScale );
+                store4( pValues + i + 4, _mm_srai_epi32( _mm_unpackhi_epi16( v, v ), 16 ), vScale );
+            }
+            else
+            {
+                const __m128i low = _mm_unpacklo_epi8( in, in );
+                const __m128i high = _mm_unpackhi_epi8( in, in );
+                store4( pValues + i, _mm_srai_epi32( _mm_unpacklo_epi16( low, low ), 24 ), vScale );
+                store4( pValues + i + 4, _mm_srai_epi32( _mm_unpackhi_epi16( low, low ), 24 ), vScale );
+                store4( pValues + i + 8, _mm_srai_epi32( _mm_unpacklo_epi16( high, high ), 24 ), vScale );
+                store4( pValues + i + 12, _mm_srai_epi32( _mm_unpackhi_epi16( high, high ), 24 ), vScale );
+            }
+        }
+        netToFixedScalar( pBytes + i * width, pValues + i, count - i, scale, width );
+    }
+#endif
+}
+
+size_t QuantizedFloat::halfToNet( const float * pValues, size_t count, ByteStreambuf & byteStreambuf )
+{
+    unsigned char * pBytes = byteStreambuf.claimPutBytes( 2 * count );
+    if ( !pBytes ) return 0;
+
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    if ( usingF16c() )
+    {
+        halfToNetF16c( pValues, count, pBytes );
+        return 2 * count;
+    }
+#endif
+    halfToNetScalar( pValues, count, pBytes );
+    return 2 * count;
+}
+
+size_t QuantizedFloat::netToHalf( ByteStreambuf & byteStreambuf, float * pValues, size_t count )
+{
+    const unsigned char * pBytes = byteStreambuf.claimGetBytes( 2 * count );
+    if ( !pBytes ) return 0;
+
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    if ( usingF16c() )
+    {
+        netToHalfF16c( pBytes, pValues, count );
+        return 2 * count;
+    }
+#endif
+    netToHalfScalar( pBytes, pValues, count );
+    return 2 * count;
+}
+
+size_t QuantizedFloat::fixedToNet( const float * pValues, size_t count, float scale, unsigned width,
+                                   ByteStreambuf & byteStreambuf )
+{
+    float lo, hi;
+    if ( !fixedLimits( width, lo, hi ) ) return 0;
+    unsigned char * pBytes = byteStreambuf.claimPutBytes( width * count );
+    if ( !pBytes ) return 0;
+
+#ifdef __SSE2__
+    fixedToNetSse2( pValues, count, scale, width, pBytes );
+#else
+    fixedToNetScalar( pValues, count, scale, width, pBytes );
+#endif
+    return width * count;
+}
+
+size_t QuantizedFloat::netToFixed( ByteStreambuf & byteStreambuf, float * pValues, size_t count, float scale,
+                                   unsigned width )
+{
+    float lo, hi;
+    if ( !fixedLimits( width, lo, hi ) ) return 0;
+    const unsigned char * pBytes = byteStreambuf.claimGetBytes( width * count );
+    if ( !pBytes ) return 0;
+
+#ifdef __SSE2__
+    netToFixedSse2( pBytes, pValues, count, scale, width );
+#else
+    netToFixedScalar( pBytes, pValues, count, scale, width );
+#endif
+    return width * count;
+}
+
+uint16_t QuantizedFloat::floatToHalf( float value )
+{
+    uint32_t x = floatBits( value );
+    const uint16_t sign = uint16_t( ( x >> 16 ) & 0x8000 );
+    x &= 0x7FFFFFFF;
+
+    // Infinity and NaN. NaN is quieted, retaining the upper bits of its payload, as F16C does.
+    if ( 0x7F800000 <= x )
+        return uint16_t( sign | ( 0x7F800000 == x ? 0x7C00 : 0x7E00 | ( ( x >> 13 ) & 0x3FF ) ) );
+
+    // Magnitudes of 65520 and above round to infinity.
+    if ( 0x477FF000 <= x ) return uint16_t( sign | 0x7C00 );
+
+    // Magnitudes below 2^-14 are subnormal as halves. Adding a magic number aligns the half's least significant
+    // bit with the float's, so the hardware addition rounds to nearest even for us.
+    if ( 0x38800000 > x )
+    {
+        const uint32_t magic = ( 127 - 15 + 23 - 10 + 1 ) << 23;
+        return uint16_t( sign | ( floatBits( bitsFloat( x ) + bitsFloat( magic ) ) - magic ) );
+    }
+
+    // Normal. Rebias the exponent and round the mantissa to nearest even.
+    const uint32_t mantissaOdd = ( x >> 13 ) & 1;
+    x += ( uint32_t( 15 - 127 ) << 23 ) + 0xFFF + mantissaOdd;
+    return uint16_t( sign | ( x >> 13 ) );
+}
+
+float QuantizedFloat::halfToFloat( uint16_t half )
+{
+    const uint32_t shiftedExponent = 0x7C00 << 13;
+    uint32_t x = uint32_t( half & 0x7FFF ) << 13;
+    const uint32_t exponent = x & shiftedExponent;
+    x += uint32_t( 127 - 15 ) << 23;
+
+    if ( shiftedExponent == exponent )
+        x += uint32_t( 128 - 16 ) << 23;    // Infinity and NaN.
+    else if ( 0 == exponent )
+    {
+        // Subnormal. Renormalize by way of a float subtraction.
+        const uint32_t magic = 113 << 23;
+        x += 1 << 23;
+        x = floatBits( bitsFloat( x ) - bitsFloat( magic ) );
+    }
+    return bitsFloat( x | ( uint32_t( half & 0x8000 ) << 16 ) );
+}
+
+bool QuantizedFloat::usingF16c()
+{
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    static const bool f16c = hasF16c();
+    return f16c;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,121 @@
+/**
+* @file QuantizedFloat.h
+* @brief The Specification for Quantized Float Array Serialization upon a ByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_QUANTIZEDFLOAT_H
+#define REISERRT_BYTESTREAMBUF_QUANTIZEDFLOAT_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        class ByteStreambuf;
+
+        /**
+        * @brief Quantized Float Array Serialization
+        *
+        * This class serializes arrays of float directly into a ByteStreambuf put area in reduced precision,
+        * and deserializes them from a get area. Two encodings are afforded:
+        * @li IEEE 754 half precision, two network ordered bytes per value, rounded to nearest even.
+        * Magnitudes beyond 65504 become infinity and NaN is preserved as a quiet NaN.
+        * @li Scaled fixed point, a signed two's complement integer of 1, 2 or 4 network ordered bytes per value.
+        * Each value is multiplied by the scale, rounded to nearest even, and saturated to the integer's range.
+        * Decoding divides by the scale. NaN encodes as zero.
+        *
+        * Half precision conversion uses the F16C instructions when the processor has them, as detected at run time,
+        * and a portable conversion otherwise. Both produce identical results. Fixed point conversion uses SSE2
+        * where the build targets it and a portable conversion otherwise.
+        *
+        * Every operation is all or nothing. If there is not room for, or not enough bytes remaining for, the whole
+        * array, the position is not advanced and zero is returned.
+        */
+        class ReiserRT_ByteStreambuf_EXPORT QuantizedFloat
+        {
+        public:
+            /**
+            * @brief Serialize Floats as Half Precision
+            *
+            * @param pValues The values.
+            * @param count The number of values.
+            * @param byteStreambuf The ByteStreambuf whose put area is written.
+            * @return Returns the number of bytes written, either 2 * count or zero.
+            */
+            static size_t halfToNet( const float * pValues, size_t count, ByteStreambuf & byteStreambuf );
+
+            /**
+            * @brief Deserialize Half Precision as Floats
+            *
+            * @param byteStreambuf The ByteStreambuf whose get area is read.
+            * @param pValues The values.
+            * @param count The number of values.
+            * @return Returns the number of bytes read, either 2 * count or zero.
+            */
+            static size_t netToHalf( ByteStreambuf & byteStreambuf, float * pValues, size_t count );
+
+            /**
+            * @brief Serialize Floats as Scaled Fixed Point
+            *
+            * @param pValues The values.
+            * @param count The number of values.
+            * @param scale The factor each value is multiplied by before rounding, for instance 256 for 8 fraction bits.
+            * @param width The width of each integer in bytes, 1, 2 or 4.
+            * @param byteStreambuf The ByteStreambuf whose put area is written.
+            * @return Returns the number of bytes written, either width * count or zero. Zero is also returned for
+            * a width other than 1, 2 or 4.
+            */
+            static size_t fixedToNet( const float * pValues, size_t count, float scale, unsigned width,
+                                      ByteStreambuf & byteStreambuf );
+
+            /**
+            * @brief Deserialize Scaled Fixed Point as Floats
+            *
+            * @param byteStreambuf The ByteStreambuf whose get area is read.
+            * @param pValues The values.
+            * @param count The number of values.
+            * @param scale The scale the values were serialized with.
+            * @param width The width of each integer in bytes, 1, 2 or 4.
+            * @return Returns the number of bytes read, either width * count or zero. Zero is also returned for
+            * a width other than 1, 2 or 4.
+            */
+            static size_t netToFixed( ByteStreambuf & byteStreambuf, float * pValues, size_t count, float scale,
+                                      unsigned width );
+
+            /**
+            * @brief Convert a Float to Half Precision
+            *
+            * The portable conversion, rounding to nearest even.
+            *
+            * @param value The value.
+            * @return Returns the half precision bits.
+            */
+            static uint16_t floatToHalf( float value );
+
+            /**
+            * @brief Convert Half Precision to a Float
+            *
+            * The portable conversion. It is exact.
+            *
+            * @param half The half precision bits.
+            * @return Returns the value.
+            */
+            static float halfToFloat( uint16_t half );
+
+            /**
+            * @brief F16C Query
+            *
+            * @return Returns true if half precision conversion uses the F16C instructions.
+            */
+            static bool usingF16c();
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_QUANTIZEDFLOAT_H
@@ -0,0 +1,188 @@
+/**
+* @file RecordIndex.cpp
+* @brief The Implementation for a Persistent Offset Index over Length Prefixed Records
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "RecordIndex.h"
+#include "Serialization.h"
+
+#include <stdexcept>
+
+using namespace ReiserRT::Utility;
+
+constexpr uint32_t RecordIndexFormat::magic;
+constexpr uint16_t RecordIndexFormat::version;
+constexpr uint32_t RecordIndexFormat::recordsPerBlock;
+constexpr size_t RecordIndexFormat::blockEntrySize;
+constexpr size_t RecordIndexFormat::footerSize;
+
+namespace
+{
+    uint64_t loadNet64( const unsigned char * p )
+    {
+        uint64_t v = 0;
+        for ( size_t i = 0; sizeof( uint64_t ) != i; ++i )
+            v = ( v << 8 ) | p[i];
+        return v;
+    }
+
+    uint32_t loadNet32( const unsigned char * p )
+    {
+        return ( uint32_t( p[0] ) << 24 ) | ( uint32_t( p[1] ) << 16 ) | ( uint32_t( p[2] ) << 8 ) | p[3];
+    }
+
+    // Decode an unsigned LEB128 varint not reading at or beyond pEnd. Returns nullptr if malformed.
+    const unsigned char * decodeVarint( const unsigned char * p, const unsigned char * pEnd, uint64_t & v )
+    {
+        v = 0;
+        for ( unsigned shift = 0; p != pEnd && 64 > shift; shift += 7 )
+        {
+            const unsigned char byte = *p++;
+            v |= uint64_t( byte & 0x7F ) << shift;
+            if ( 0 == ( byte & 0x80 ) ) return p;
+        }
+        return nullptr;
+    }
+}
+
+RecordIndexBuilder::RecordIndexBuilder( OutputByteStream & indexStream )
+  : _indexStream( indexStream )
+{
+}
+
+bool RecordIndexBuilder::addRecord( uint64_t offset )
+{
+    if ( _finished || !_indexStream ) return false;
+    if ( 0 != _recordCount && offset <= _lastOffset ) return false;
+
+    if ( 0 == _recordCount % RecordIndexFormat::recordsPerBlock )
+    {
+        _blockTable.push_back( offset );
+        _blockTable.push_back( _deltaBytes );
+    }
+    else
+    {
+        uint64_t delta = offset - _lastOffset;
+        do {
+            unsigned char byte = delta & 0x7F;
+            delta >>= 7;
+            if ( delta ) byte |= 0x80;
+            _indexStream.put( byte );
+            ++_deltaBytes;
+        } while ( delta );
+        if ( !_indexStream ) return false;
+    }
+
+    _lastOffset = offset;
+    ++_recordCount;
+    return true;
+}
+
+uint64_t RecordIndexBuilder::addRecords( InputByteStream & dataStream )
+{
+    uint64_t numAdded = 0;
+    for ( ;; )
+    {
+        const std::streampos recordOffset = dataStream.tellg();
+        if ( std::streampos( -1 ) == recordOffset ) break;
+
+        uint32_t recordLength;
+        if ( sizeof( recordLength ) != netToType( dataStream, recordLength ) ) break;
+
+        // Skip over the payload. If the record is truncated, the seek fails and we do not index it.
+        if ( !dataStream.seekg( std::streamoff( recordLength ), std::ios_base::cur ) ) break;
+
+        if ( !addRecord( uint64_t( std::streamoff( recordOffset ) ) ) ) break;
+        ++numAdded;
+    }
+    return numAdded;
+}
+
+uint64_t RecordIndexBuilder::finish()
+{
+    if ( _finished ) return 0;
+    _finished = true;
+
+    const uint64_t blockTableOffset = _deltaBytes;
+    for ( const auto v : _blockTable )
+        typeToNet( v, _indexStream );
+
+    typeToNet( RecordIndexFormat::magic, _indexStream );
+    typeToNet( RecordIndexFormat::version, _indexStream );
+    typeToNet( uint16_t( 0 ), _indexStream );
+    typeToNet( RecordIndexFormat::recordsPerBlock, _indexStream );
+    typeToNet( uint32_t( 0 ), _indexStream );
+    typeToNet( _recordCount, _indexStream );
+    typeToNet( blockTableOffset, _indexStream );
+
+    if ( !_indexStream ) return 0;
+    return blockTableOffset + _blockTable.size() * sizeof( uint64_t ) + RecordIndexFormat::footerSize;
+}
+
+RecordIndex::RecordIndex( const unsigned char * pIndex, size_t len )
+  : _pIndex( pIndex )
+  , _pBlockTable( nullptr )
+  , _recordCount( 0 )
+  , _blockCount( 0 )
+  , _deltaSectionSize( 0 )
+{
+    if ( nullptr == pIndex || RecordIndexFormat::footerSize > len )
+        throw std::invalid_argument( "RecordIndex: index too small to contain a footer" );
+
+    const unsigned char * pFooter = pIndex + len - RecordIndexFormat::footerSize;
+    if ( RecordIndexFormat::magic != loadNet32( pFooter ) )
+        throw std::invalid_argument( "RecordIndex: bad magic number" );
+    if ( RecordIndexFormat::version != ( ( pFooter[4] << 8 ) | pFooter[5] ) )
+        throw std::invalid_argument( "RecordIndex: unsupported version" );
+    if ( RecordIndexFormat::recordsPerBlock != loadNet32( pFooter + 8 ) )
+        throw std::invalid_argument( "RecordIndex: unsupported records per block" );
+
+    _recordCount = loadNet64( pFooter + 16 );
+    _deltaSectionSize = loadNet64( pFooter + 24 );
+    // Rounded up without adding to the count, which would wrap for a hostile count near the maximum.
+    _blockCount = _recordCount / RecordIndexFormat::recordsPerBlock +
+                  ( 0 != _recordCount % RecordIndexFormat::recordsPerBlock );
+
+    // Verify the sections exactly account for the index length. Guard against overflow from hostile counts.
+    const uint64_t available = len - RecordIndexFormat::footerSize;
+    if ( _deltaSectionSize > available ||
+         _blockCount > ( available - _deltaSectionSize ) / RecordIndexFormat::blockEntrySize ||
+         _deltaSectionSize + _blockCount * RecordIndexFormat::blockEntrySize != available )
+        throw std::invalid_argument( "RecordIndex: section sizes inconsistent with index length" );
+
+    _pBlockTable = pIndex + _deltaSectionSize;
+}
+
+uint64_t RecordIndex::offset( uint64_t n ) const
+{
+    if ( n >= _recordCount )
+        throw std::out_of_range( "RecordIndex: record number out of range" );
+
+    const uint64_t block = n / RecordIndexFormat::recordsPerBlock;
+    const unsigned char * pEntry = _pBlockTable + block * RecordIndexFormat::blockEntrySize;
+    uint64_t recordOffset = loadNet64( pEntry );
+    const uint64_t deltaOffset = loadNet64( pEntry + sizeof( uint64_t ) );
+    if ( deltaOffset > _deltaSectionSize )
+        throw std::out_of_range( "RecordIndex: corrupt block table entry" );
+
+    const unsigned char * p = _pIndex + deltaOffset;
+    const unsigned char * pEnd = _pBlockTable;
+    for ( uint64_t i = block * RecordIndexFormat::recordsPerBlock; n != i; ++i )
+    {
+        uint64_t delta;
+        p = decodeVarint( p, pEnd, delta );
+        if ( nullptr == p )
+            throw std::out_of_range( "RecordIndex: corrupt delta section" );
+        recordOffset += delta;
+    }
+
+    return recordOffset;
+}
+
+bool RecordIndex::seek( InputByteStream & dataStream, uint64_t n ) const
+{
+    if ( n >= _recordCount ) return false;
+    return bool( dataStream.seekg( std::streampos( std::streamoff( offset( n ) ) ) ) );
+}
@@ -0,0 +1,175 @@
+/**
+* @file RecordIndex.h
+* @brief The Specification for a Persistent Offset Index over Length Prefixed Records
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_RECORDINDEX_H
+#define REISERRT_BYTESTREAMBUF_RECORDINDEX_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreamTypesFwd.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Record Index Format Constants
+        *
+        * An index is a stream of bytes laid out as follows. All fixed width integers are network ordered.
+        * @li A delta section. For every record that does not begin a block, the distance in bytes from the
+        * previous record's offset, encoded as an unsigned LEB128 varint.
+        * @li A block table. For every block of `recordsPerBlock` records, the absolute offset of the block's
+        * first record and the offset of the block's first delta within the delta section, both 64-bit.
+        * @li A fixed size footer containing the magic number, format version, records per block,
+        * record count and block table offset.
+        *
+        * The footer lives at the end so that the index may be built in a single streaming pass without
+        * knowing the record count in advance.
+        */
+        struct RecordIndexFormat
+        {
+            static constexpr uint32_t magic = 0x52524958;       //!< "RRIX"
+            static constexpr uint16_t version = 1;              //!< Format version
+            static constexpr uint32_t recordsPerBlock = 64;     //!< Records between absolute offsets.
+            static constexpr size_t blockEntrySize = 16;        //!< Size of a block table entry.
+            static constexpr size_t footerSize = 32;            //!< Size of the footer.
+        };
+
+        /**
+        * @brief Record Index Builder
+        *
+        * This class builds a record index in a single streaming pass. Records are expected to be
+        * prefixed by a 32-bit, network ordered length which does not include the length prefix itself.
+        * The index is written to a user provided output byte stream as records are added. Only the
+        * block table, 16 bytes for every 64 records, is retained in memory until `finish` is invoked.
+        *
+        * The resulting index bytes are intended to be stored alongside the data file and later
+        * mapped into memory for use by a RecordIndex instance.
+        */
+        class ReiserRT_ByteStreambuf_EXPORT RecordIndexBuilder
+        {
+        public:
+            /**
+            * @brief Constructor for RecordIndexBuilder
+            *
+            * @param indexStream The output byte stream the index is written to. It must out live this object.
+            */
+            explicit RecordIndexBuilder( OutputByteStream & indexStream );
+
+            /**
+            * @brief Add a Record Offset
+            *
+            * Adds the offset of the next record to the index. Offsets must be strictly increasing.
+            *
+            * @param offset The offset of the record's length prefix within the data.
+            * @return Returns true if the offset was indexed. Returns false if the offset is not greater than the
+            * previous offset or the index stream is no longer in a good state.
+            */
+            bool addRecord( uint64_t offset );
+
+            /**
+            * @brief Index Length Prefixed Records in a Data Stream
+            *
+            * Walks the data stream from its current get position, indexing each complete length prefixed record.
+            * The walk stops at the end of the stream or upon a truncated record, which is not indexed.
+            * Record payloads are skipped via seekg and are never read.
+            *
+            * @param dataStream The input byte stream containing the length prefixed records.
+            * @return Returns the number of records indexed by this invocation.
+            */
+            uint64_t addRecords( InputByteStream & dataStream );
+
+            /**
+            * @brief Finish the Index
+            *
+            * Writes the block table and footer onto the index stream. No more records may be added afterwards.
+            *
+            * @return Returns the total number of bytes of index written, or zero if the index stream failed.
+            */
+            uint64_t finish();
+
+            /**
+            * @brief The Number of Records Indexed
+            *
+            * @return Returns the number of records indexed so far.
+            */
+            uint64_t recordCount() const { return _recordCount; }
+
+        private:
+            OutputByteStream & _indexStream;
+            std::vector< uint64_t > _blockTable;
+            uint64_t _recordCount{ 0 };
+            uint64_t _lastOffset{ 0 };
+            uint64_t _deltaBytes{ 0 };
+            bool _finished{ false };
+        };
+
+        /**
+        * @brief Record Index Reader
+        *
+        * This class affords random access to record offsets from an index produced by RecordIndexBuilder.
+        * It operates in place over user provided memory, typically a read only memory mapping of the
+        * index file, and does not take ownership of it. Looking up a record costs one block table access
+        * plus at most 63 varint decodes.
+        */
+        class ReiserRT_ByteStreambuf_EXPORT RecordIndex
+        {
+        public:
+            /**
+            * @brief Constructor for RecordIndex
+            *
+            * Validates the footer and block table bounds of the index.
+            *
+            * @param pIndex A pointer to the index bytes.
+            * @param len The length of the index in bytes.
+            * @throw Throws std::invalid_argument if the index is malformed.
+            */
+            RecordIndex( const unsigned char * pIndex, size_t len );
+
+            /**
+            * @brief The Number of Records Indexed
+            *
+            * @return Returns the number of records in the index.
+            */
+            uint64_t size() const { return _recordCount; }
+
+            /**
+            * @brief Lookup a Record Offset
+            *
+            * @param n The zero based record number.
+            * @return Returns the offset of record n's length prefix within the data.
+            * @throw Throws std::out_of_range if n is not less than size().
+            */
+            uint64_t offset( uint64_t n ) const;
+
+            /**
+            * @brief Seek to a Record
+            *
+            * Positions the data stream's get position at record n's length prefix via seekg,
+            * without scanning preceding records.
+            *
+            * @param dataStream The input byte stream containing the length prefixed records.
+            * @param n The zero based record number.
+            * @return Returns true if the seek succeeded. Returns false if n is out of range or the seek failed.
+            */
+            bool seek( InputByteStream & dataStream, uint64_t n ) const;
+
+        private:
+            const unsigned char * _pIndex;
+            const unsigned char * _pBlockTable;
+            uint64_t _recordCount;
+            uint64_t _blockCount;
+            uint64_t _deltaSectionSize;
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_RECORDINDEX_H
@@ -9,8 +9,10 @@
 #define REISERRT_BYTESTREAMBUF_SERIALIZATION_H
 
 #include "ByteStreamTypesFwd.h"
+#include "ByteStreambuf.h"
 
 #include <iostream>
+#include <type_traits>
 #include <endian.h>
 
 namespace ReiserRT
@@ -101,6 +103,94 @@ namespace ReiserRT
             return _serializeToByteStream< T >( byteStream, reinterpret_cast< const unsigned char * >( &t ) );
         }
 
+        /**
+        * @brief Load a Type from Network Ordered Bytes in Memory
+        *
+        * This helper template operation converts sizeof( T ) network ordered bytes at the given address into type T.
+        *
+        * @tparam T Type T is the type to convert to. It must be a numeric or enumerator type.
+        * @param pBytes A pointer to the network ordered bytes. No alignment is required.
+        * @return Returns value type T.
+        */
+        template < typename T >
+        T _loadNetOrder( const unsigned char * pBytes );
+
+        /**
+        * @brief Store a Type as Network Ordered Bytes in Memory
+        *
+        * This helper template operation converts type T into sizeof( T ) network ordered bytes at the given address.
+        *
+        * @tparam T Type T is the type to convert from. It must be a numeric or enumerator type.
+        * @param pBytes A pointer to where the network ordered bytes are to be stored. No alignment is required.
+        * @param t The value to store.
+        */
+        template < typename T >
+        void _storeNetOrder( unsigned char * pBytes, const T & t );
+
+        /**
+        * @brief Convert Network Ordered Bytes from a ByteStreambuf into a Type
+        *
+        * This template operation converts network ordered bytes directly from the ByteStreambuf get area into
+        * return value type T. It bypasses the virtual basic_streambuf interface and the istream sentry.
+        * The conversion is all or nothing. If fewer than sizeof( T ) bytes remain, the get position is not advanced
+        * and a zero valued T is returned. There is no stream state. If this must be detected, use the overload
+        * returning the number of bytes deserialized.
+        *
+        * @tparam T Type T is the type to convert to and return. It must be a numeric or enumerator type.
+        * @param byteStreambuf A reference to the ByteStreambuf containing the network ordered bytes.
+        * @return Returns value type T.
+        */
+        template < typename T >
+        T netToType( ByteStreambuf & byteStreambuf )
+        {
+            const unsigned char * pBytes = byteStreambuf.claimGetBytes( sizeof( T ) );
+            return pBytes ? _loadNetOrder< T >( pBytes ) : T();
+        }
+
+        /**
+        * @brief Convert Network Ordered Bytes from a ByteStreambuf into a Type
+        *
+        * This template operation converts network ordered bytes directly from the ByteStreambuf get area into
+        * type T via output argument. It bypasses the virtual basic_streambuf interface and the istream sentry.
+        * The conversion is all or nothing. If fewer than sizeof( T ) bytes remain, the get position is not advanced
+        * and t is not modified.
+        *
+        * @tparam T Type T is the type to convert to. It must be a numeric or enumerator type.
+        * @param byteStreambuf A reference to the ByteStreambuf containing the network ordered bytes.
+        * @param t The deserialized value.
+        * @return The number of bytes deserialized, either sizeof( T ) or zero.
+        */
+        template < typename T >
+        size_t netToType( ByteStreambuf & byteStreambuf, T & t )
+        {
+            const unsigned char * pBytes = byteStreambuf.claimGetBytes( sizeof( T ) );
+            if ( !pBytes ) return 0;
+            t = _loadNetOrder< T >( pBytes );
+            return sizeof( T );
+        }
+
+        /**
+        * @brief Convert a Type onto a Network Ordered ByteStreambuf.
+        *
+        * This template operation converts a type of type T directly into the ByteStreambuf put area.
+        * It bypasses the virtual basic_streambuf interface and the ostream sentry.
+        * The conversion is all or nothing. If there is not room for sizeof( T ) bytes, the put position is
+        * not advanced.
+        *
+        * @tparam T Type T is the type to convert from. It must be a numeric or enumerator type.
+        * @param t The value to serialize.
+        * @param byteStreambuf A reference to the ByteStreambuf where the network ordered bytes will be written to.
+        * @return The number of bytes serialized, either sizeof( T ) or zero.
+        */
+        template < typename T >
+        size_t typeToNet( const T & t, ByteStreambuf & byteStreambuf )
+        {
+            unsigned char * pBytes = byteStreambuf.claimPutBytes( sizeof( T ) );
+            if ( !pBytes ) return 0;
+            _storeNetOrder< T >( pBytes, t );
+            return sizeof( T );
+        }
+
 
         /////////// Template Helper Operations Implementations Below ////////////
 
@@ -166,6 +256,41 @@ namespace ReiserRT
             return i;
         }
 
+        template < typename T >
+        T _loadNetOrder( const unsigned char * pBytes )
+        {
+            static_assert( std::is_integral<T>::value || std::is_floating_point<T>::value || std::is_enum<T>::value,
+                           "Type T must be an integer, floating point or enumerator type" );
+            union { unsigned char buf[ sizeof ( T ) ]; T t; } u;
+#if ( __BYTE_ORDER == __BIG_ENDIAN )
+            for ( size_t i = 0; sizeof( T ) != i; ++i )
+                u.buf[ i ] = pBytes[ i ];
+#elif ( __BYTE_ORDER == __LITTLE_ENDIAN )
+            for ( size_t i = 0; sizeof( T ) != i; ++i )
+                u.buf[ i ] = pBytes[ sizeof( T ) - 1 - i ];
+#else
+#error "Preprocessor symbol __BYTE_ORDER must be defined as __BIG_ENDIAN or __LITTLE_ENDIAN!!!"
+#endif
+            return u.t;
+        }
+
+        template < typename T >
+        void _storeNetOrder( unsigned char * pBytes, const T & t )
+        {
+            static_assert( std::is_integral<T>::value || std::is_floating_point<T>::value || std::is_enum<T>::value,
+                           "Type T must be an integer, floating point or enumerator type" );
+            const unsigned char * pType = reinterpret_cast< const unsigned char * >( &t );
+#if ( __BYTE_ORDER == __BIG_ENDIAN )
+            for ( size_t i = 0; sizeof( T ) != i; ++i )
+                pBytes[ i ] = pType[ i ];
+#elif ( __BYTE_ORDER == __LITTLE_ENDIAN )
+            for ( size_t i = 0; sizeof( T ) != i; ++i )
+                pBytes[ i ] = pType[ sizeof( T ) - 1 - i ];
+#else
+#error "Preprocessor symbol __BYTE_ORDER must be defined as __BIG_ENDIAN or __LITTLE_ENDIAN!!!"
+#endif
+        }
+
     }
 }
 
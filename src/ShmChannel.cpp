@@ -0,0 +1,374 @@
+/**
+* @file ShmChannel.cpp
+* @brief The Implementation for a Shared Memory Message Channel Between Processes
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ShmChannel.h"
+
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <new>
+#include <system_error>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+using namespace ReiserRT::Utility;
+
+constexpr uint32_t ShmChannelFormat::magic;
+constexpr uint32_t ShmChannelFormat::version;
+constexpr size_t ShmChannelFormat::cacheLineSize;
+constexpr size_t ShmChannelFormat::headerSize;
+constexpr size_t ShmChannelFormat::slotPrefixSize;
+
+static_assert( 2 == ATOMIC_INT_LOCK_FREE, "Shared memory atomics must be lock free to be shared between processes" );
+
+// Each side's line holds the index it advances, a flag it raises before sleeping and the futex word it sleeps on.
+// The other side bumps the futex word before waking it, so that a wakeup racing with going to sleep is not lost.
+struct ShmChannel::Header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t slotSize;
+    uint64_t slotStride;
+    uint64_t numSlots;
+
+    alignas( ShmChannelFormat::cacheLineSize ) std::atomic< uint32_t > head;
+    std::atomic< uint32_t > closed;
+    std::atomic< uint32_t > consumerWaiting;
+    std::atomic< uint32_t > consumerFutex;
+
+    alignas( ShmChannelFormat::cacheLineSize ) std::atomic< uint32_t > tail;
+    std::atomic< uint32_t > producerWaiting;
+    std::atomic< uint32_t > producerFutex;
+};
+
+namespace
+{
+    constexpr unsigned minSpin = 16;
+    constexpr unsigned initialSpin = 1024;
+    constexpr unsigned maxSpin = 8192;
+
+    void cpuRelax()
+    {
+#if defined( __x86_64__ ) || defined( __i386__ )
+        __builtin_ia32_pause();
+#elif defined( __aarch64__ )
+        asm volatile( "yield" );
+#endif
+    }
+
+    long futex( std::atomic< uint32_t > & word, int op, uint32_t value, const timespec * pTimeout )
+    {
+        return syscall( SYS_futex, reinterpret_cast< uint32_t * >( &word ), op, value, pTimeout, nullptr, 0 );
+    }
+
+    void wake( std::atomic< uint32_t > & waiting, std::atomic< uint32_t > & futexWord )
+    {
+        // Orders the index just advanced before reading the flag, pairing with the fence in wait.
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        // Clearing the flag wakes a sleeper once, however many times the index advances before it runs.
+        if ( 0 != waiting.load( std::memory_order_relaxed ) && 0 != waiting.exchange( 0, std::memory_order_relaxed ) )
+        {
+            futexWord.fetch_add( 1, std::memory_order_relaxed );
+            futex( futexWord, FUTEX_WAKE, 1, nullptr );
+        }
+    }
+
+    // Waits until ready returns true or the timeout expires, spinning and then sleeping.
+    template < typename Ready >
+    bool wait( Ready ready, std::atomic< uint32_t > & waiting, std::atomic< uint32_t > & futexWord,
+               unsigned & spinLimit, ShmChannel::Timeout timeout )
+    {
+        if ( ready() ) return true;
+        if ( ShmChannel::Timeout::zero() == timeout ) return false;
+
+        for ( unsigned i = 0; spinLimit != i; ++i )
+        {
+            cpuRelax();
+            if ( ready() )
+            {
+                spinLimit = spinLimit < maxSpin ? spinLimit * 2 : maxSpin;
+                return true;
+            }
+        }
+        spinLimit = spinLimit > minSpin ? spinLimit / 2 : minSpin;
+
+        const bool forever = ShmChannel::Timeout::max() == timeout;
+        const auto deadline = forever ? std::chrono::steady_clock::time_point::max() :
+                              std::chrono::steady_clock::now() + timeout;
+        for ( ;; )
+        {
+            waiting.store( 1, std::memory_order_relaxed );
+            const uint32_t sequence = futexWord.load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+            if ( ready() ) break;
+
+            timespec remaining{};
+            if ( !forever )
+            {
+                const auto left = deadline - std::chrono::steady_clock::now();
+                if ( left <= std::chrono::steady_clock::duration::zero() )
+                {
+                    waiting.store( 0, std::memory_order_relaxed );
+                    return false;
+                }
+                const auto ns = std::chrono::duration_cast< std::chrono::nanoseconds >( left ).count();
+                remaining.tv_sec = time_t( ns / 1000000000 );
+                remaining.tv_nsec = long( ns % 1000000000 );
+            }
+            futex( futexWord, FUTEX_WAIT, sequence, forever ? nullptr : &remaining );
+        }
+        waiting.store( 0, std::memory_order_relaxed );
+        return true;
+    }
+
+    // Indices are free running 32-bit counters, so the slot count must divide 2^32. Nothing is created unless
+    // the geometry is valid.
+    void checkGeometry( size_t slotSize, size_t numSlots )
+    {
+        if ( 0 == slotSize || slotSize > UINT32_MAX || 0 == numSlots || numSlots > ( size_t( 1 ) << 31 ) )
+            throw std::system_error( EINVAL, std::generic_category(), "ShmChannel" );
+    }
+
+    size_t roundUpPowerOfTwo( size_t n )
+    {
+        size_t p = 1;
+        while ( p < n ) p <<= 1;
+        return p;
+    }
+}
+
+ShmChannel::ShmChannel( size_t slotSize, size_t numSlots )
+  : _slotStreambuf( nullptr, 0, std::ios_base::out )
+  , _message( nullptr, 0 )
+  , _stream( &_message )
+  , _spinLimit( initialSpin )
+{
+    checkGeometry( slotSize, numSlots );
+    _fd = memfd_create( "ReiserRT_ShmChannel", MFD_CLOEXEC );
+    if ( 0 > _fd ) throw std::system_error( errno, std::generic_category(), "ShmChannel: memfd_create" );
+    _create( slotSize, numSlots );
+}
+
+ShmChannel::ShmChannel( int fd )
+  : _slotStreambuf( nullptr, 0, std::ios_base::out )
+  , _message( nullptr, 0 )
+  , _stream( &_message )
+  , _spinLimit( initialSpin )
+{
+    _fd = fcntl( fd, F_DUPFD_CLOEXEC, 0 );
+    if ( 0 > _fd ) throw std::system_error( errno, std::generic_category(), "ShmChannel: fcntl" );
+    _attach();
+}
+
+ShmChannel::ShmChannel( const char * name, size_t slotSize, size_t numSlots )
+  : _slotStreambuf( nullptr, 0, std::ios_base::out )
+  , _message( nullptr, 0 )
+  , _stream( &_message )
+  , _spinLimit( initialSpin )
+{
+    checkGeometry( slotSize, numSlots );
+    _fd = shm_open( name, O_RDWR | O_CREAT | O_EXCL, 0600 );
+    if ( 0 > _fd ) throw std::system_error( errno, std::generic_category(), name );
+
+    // The name is ours, so it must not outlive a failure to create the channel, or every retry would fail.
+    try
+    {
+        _create( slotSize, numSlots );
+    }
+    catch ( ... )
+    {
+        shm_unlink( name );
+        throw;
+    }
+}
+
+ShmChannel::ShmChannel( const char * name )
+  : _slotStreambuf( nullptr, 0, std::ios_base::out )
+  , _message( nullptr, 0 )
+  , _stream( &_message )
+  , _spinLimit( initialSpin )
+{
+    _fd = shm_open( name, O_RDWR, 0 );
+    if ( 0 > _fd ) throw std::system_error( errno, std::generic_category(), name );
+    _attach();
+}
+
+ShmChannel::~ShmChannel()
+{
+    _unmap();
+}
+
+bool ShmChannel::remove( const char * name )
+{
+    return 0 == shm_unlink( name );
+}
+
+ByteStreambuf * ShmChannel::acquire( Timeout timeout )
+{
+    const uint32_t head = _pHeader->head.load( std::memory_order_relaxed );
+    auto notFull = [&]() { return head - _pHeader->tail.load( std::memory_order_acquire ) != _numSlots; };
+    if ( !_acquired && !wait( notFull, _pHeader->producerWaiting, _pHeader->producerFutex, _spinLimit, timeout ) )
+        return nullptr;
+
+    _acquired = true;
+    _slotStreambuf.pubsetbuf( _slot( head ) + ShmChannelFormat::slotPrefixSize, std::streamsize( _slotSize ) );
+    return &_slotStreambuf;
+}
+
+void ShmChannel::publish()
+{
+    if ( !_acquired ) return;
+    _acquired = false;
+
+    const uint32_t head = _pHeader->head.load( std::memory_order_relaxed );
+    const uint32_t len = uint32_t( _slotStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) );
+    memcpy( _slot( head ), &len, sizeof( len ) );
+    _pHeader->head.store( head + 1, std::memory_order_release );
+    wake( _pHeader->consumerWaiting, _pHeader->consumerFutex );
+}
+
+void ShmChannel::close()
+{
+    _pHeader->closed.store( 1, std::memory_order_release );
+    wake( _pHeader->consumerWaiting, _pHeader->consumerFutex );
+}
+
+InputByteStream * ShmChannel::receive( Timeout timeout )
+{
+    const uint32_t tail = _pHeader->tail.load( std::memory_order_relaxed );
+    auto notEmpty = [&]() { return _pHeader->head.load( std::memory_order_acquire ) != tail; };
+    auto readyOrClosed = [&]() { return notEmpty() || 0 != _pHeader->closed.load( std::memory_order_acquire ); };
+    if ( !_received && !wait( readyOrClosed, _pHeader->consumerWaiting, _pHeader->consumerFutex, _spinLimit, timeout ) )
+        return nullptr;
+
+    // Closed, but messages published before closing are still delivered.
+    if ( !notEmpty() ) return nullptr;
+
+    uint32_t len;
+    const unsigned char * const pSlot = _slot( tail );
+    memcpy( &len, pSlot, sizeof( len ) );
+    const size_t slotCapacity = _slotStride - ShmChannelFormat::slotPrefixSize;
+    if ( len > slotCapacity ) len = uint32_t( slotCapacity );
+
+    _received = true;
+    _message.pubsetbuf( const_cast< unsigned char * >( pSlot ) + ShmChannelFormat::slotPrefixSize, std::streamsize( len ) );
+    _stream.clear();
+    return &_stream;
+}
+
+void ShmChannel::release()
+{
+    if ( !_received ) return;
+    _received = false;
+
+    const uint32_t tail = _pHeader->tail.load( std::memory_order_relaxed ) + 1;
+    _pHeader->tail.store( tail, std::memory_order_release );
+
+    // A producer asleep on a full ring is woken once half of it has drained, rather than for every slot freed,
+    // so that it refills the ring in bursts. Its head cannot move while it sleeps, so the ring does drain.
+    if ( _pHeader->head.load( std::memory_order_relaxed ) - tail <= _numSlots / 2 )
+        wake( _pHeader->producerWaiting, _pHeader->producerFutex );
+}
+
+void ShmChannel::_create( size_t slotSize, size_t numSlots )
+{
+    static_assert( ShmChannelFormat::headerSize == sizeof( Header ), "Header does not match its format size" );
+
+    _slotSize = slotSize;
+    _numSlots = roundUpPowerOfTwo( numSlots );
+    _slotStride = ( ShmChannelFormat::slotPrefixSize + slotSize + ShmChannelFormat::cacheLineSize - 1 ) /
+                  ShmChannelFormat::cacheLineSize * ShmChannelFormat::cacheLineSize;
+    _mappedSize = ShmChannelFormat::headerSize + _slotStride * _numSlots;
+
+    if ( 0 != ftruncate( _fd, off_t( _mappedSize ) ) )
+    {
+        const int error = errno;
+        _unmap();
+        throw std::system_error( error, std::generic_category(), "ShmChannel: ftruncate" );
+    }
+    void * pMemory = mmap( nullptr, _mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0 );
+    if ( MAP_FAILED == pMemory )
+    {
+        const int error = errno;
+        _unmap();
+        throw std::system_error( error, std::generic_category(), "ShmChannel: mmap" );
+    }
+    _pMemory = static_cast< unsigned char * >( pMemory );
+
+    _pHeader = new ( _pMemory ) Header();
+    _pHeader->magic = ShmChannelFormat::magic;
+    _pHeader->version = ShmChannelFormat::version;
+    _pHeader->slotSize = _slotSize;
+    _pHeader->slotStride = _slotStride;
+    _pHeader->numSlots = _numSlots;
+}
+
+void ShmChannel::_attach()
+{
+    struct stat st{};
+    if ( 0 != fstat( _fd, &st ) )
+    {
+        const int error = errno;
+        _unmap();
+        throw std::system_error( error, std::generic_category(), "ShmChannel: fstat" );
+    }
+    if ( size_t( st.st_size ) < ShmChannelFormat::headerSize )
+    {
+        _unmap();
+        throw std::system_error( EINVAL, std::generic_category(), "ShmChannel: not a channel" );
+    }
+    _mappedSize = size_t( st.st_size );
+    void * pMemory = mmap( nullptr, _mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0 );
+    if ( MAP_FAILED == pMemory )
+    {
+        const int error = errno;
+        _unmap();
+        throw std::system_error( error, std::generic_category(), "ShmChannel: mmap" );
+    }
+    _pMemory = static_cast< unsigned char * >( pMemory );
+    _pHeader = reinterpret_cast< Header * >( _pMemory );
+
+    // The geometry must be self consistent and fit what was mapped. It is written by another process, so it is
+    // checked without arithmetic which could wrap.
+    const Header & header = *_pHeader;
+    const bool valid = ShmChannelFormat::magic == header.magic && ShmChannelFormat::version == header.version &&
+                       0 != header.numSlots && 0 == ( header.numSlots & ( header.numSlots - 1 ) ) &&
+                       header.numSlots <= ( uint64_t( 1 ) << 31 ) &&
+                       header.slotSize <= UINT32_MAX &&
+                       header.slotStride >= ShmChannelFormat::slotPrefixSize &&
+                       header.slotSize <= header.slotStride - ShmChannelFormat::slotPrefixSize &&
+                       header.slotStride <= _mappedSize &&
+                       header.numSlots <= ( _mappedSize - ShmChannelFormat::headerSize ) / header.slotStride;
+    if ( !valid )
+    {
+        _unmap();
+        throw std::system_error( EINVAL, std::generic_category(), "ShmChannel: not a channel" );
+    }
+    _slotSize = size_t( header.slotSize );
+    _slotStride = size_t( header.slotStride );
+    _numSlots = size_t( header.numSlots );
+}
+
+void ShmChannel::_unmap()
+{
+    if ( _pMemory ) munmap( _pMemory, _mappedSize );
+    if ( 0 <= _fd ) ::close( _fd );
+    _pMemory = nullptr;
+    _pHeader = nullptr;
+    _fd = -1;
+}
+
+unsigned char * ShmChannel::_slot( uint32_t index ) const
+{
+    return _pMemory + ShmChannelFormat::headerSize + size_t( index & uint32_t( _numSlots - 1 ) ) * _slotStride;
+}
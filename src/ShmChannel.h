@@ -0,0 +1,237 @@
+/**
+* @file ShmChannel.h
+* @brief The Specification for a Shared Memory Message Channel Between Processes
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_SHMCHANNEL_H
+#define REISERRT_BYTESTREAMBUF_SHMCHANNEL_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "ByteStreamTypesFwd.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Shared Memory Channel Format Constants
+        *
+        * A channel's shared memory holds a header of three cache lines, the first describing the slots and the others
+        * holding each side's index and wakeup state, followed by the slots. Each slot begins with a prefix of
+        * slotPrefixSize bytes, the first four of which hold the message length in host order and the rest of which
+        * are reserved. The message follows the prefix. Slots are padded to a multiple of the cache line size.
+        */
+        struct ShmChannelFormat
+        {
+            static constexpr uint32_t magic = 0x52525343;       //!< "RRSC"
+            static constexpr uint32_t version = 1;              //!< Format version
+            static constexpr size_t cacheLineSize = 64;         //!< Alignment of the header's lines and the slots.
+            static constexpr size_t headerSize = 192;           //!< Size of the header.
+            static constexpr size_t slotPrefixSize = 8;         //!< Size of the length preceding each message.
+        };
+
+        /**
+        * @brief Shared Memory Message Channel
+        *
+        * This class passes messages from one producer to one consumer, typically in different processes, through
+        * a lock free ring of fixed size slots in shared memory. The producer serializes each message directly into
+        * a slot through a ByteStreambuf, and the consumer decodes it in place through an InputByteStream.
+        * Nothing is copied and no system call is made while the other side keeps up.
+        *
+        * A side finding the ring empty, or full, spins briefly before sleeping on a futex in the shared memory.
+        * The spin adapts, lengthening while spinning succeeds and shortening when it does not, so that a side
+        * kept waiting by a slow peer soon stops burning its processor. The other side wakes a sleeper only when
+        * one is flagged as waiting.
+        *
+        * The memory is either an anonymous memfd, shared with a child process by fork or with another process by
+        * passing its file descriptor, or a named POSIX shared memory object. Each side maps it with its own
+        * ShmChannel instance. One instance must not be used as both producer and consumer.
+        *
+        * @code ShmChannel channel( 256, 1024 );
+        * @code if ( 0 == fork() ) { while ( InputByteStream * pMessage = channel.receive() ) { decode( *pMessage ); channel.release(); } }
+        * @code ByteStreambuf * pSlot = channel.acquire();
+        * @code typeToNet( sequence, *pSlot );
+        * @code channel.publish();
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT ShmChannel
+        {
+        public:
+            /**
+            * @brief Timeout Type
+            *
+            * The longest a blocking operation waits. The maximum waits indefinitely and zero does not wait.
+            */
+            using Timeout = std::chrono::microseconds;
+
+            /**
+            * @brief Constructor for an Anonymous ShmChannel
+            *
+            * Creates a channel in a new memfd.
+            *
+            * @param slotSize The largest message a slot holds.
+            * @param numSlots The number of slots, rounded up to a power of two.
+            * @throw Throws std::system_error if the slot size or count is out of range, or the memory cannot be created
+            * or mapped.
+            */
+            ShmChannel( size_t slotSize, size_t numSlots );
+
+            /**
+            * @brief Constructor Attaching to an Anonymous ShmChannel
+            *
+            * Attaches to a channel created by another instance, from a duplicate of its file descriptor.
+            *
+            * @param fd The file descriptor of the channel's memory, as returned by fd. It is duplicated.
+            * @throw Throws std::system_error if the memory cannot be mapped or does not hold a channel.
+            */
+            explicit ShmChannel( int fd );
+
+            /**
+            * @brief Constructor for a Named ShmChannel
+            *
+            * Creates a channel in a new POSIX shared memory object. The name persists until removed, unless creating the
+            * channel fails, in which case it is removed.
+            *
+            * @param name The name, beginning with a slash.
+            * @param slotSize The largest message a slot holds.
+            * @param numSlots The number of slots, rounded up to a power of two.
+            * @throw Throws std::system_error if the slot size or count is out of range, or the object exists or cannot
+            * be created or mapped.
+            */
+            ShmChannel( const char * name, size_t slotSize, size_t numSlots );
+
+            /**
+            * @brief Constructor Opening a Named ShmChannel
+            *
+            * @param name The name the channel was created with.
+            * @throw Throws std::system_error if the object cannot be opened or mapped or does not hold a channel.
+            */
+            explicit ShmChannel( const char * name );
+
+            /**
+            * @brief Destructor for ShmChannel
+            *
+            * Unmaps the memory. The channel persists while the other side has it mapped.
+            */
+            ~ShmChannel();
+
+            ShmChannel( const ShmChannel & ) = delete;
+            ShmChannel & operator=( const ShmChannel & ) = delete;
+
+            /**
+            * @brief Remove a Named Channel
+            *
+            * Removes the name. Sides having it mapped are unaffected.
+            *
+            * @param name The name the channel was created with.
+            * @return Returns true if the name was removed.
+            */
+            static bool remove( const char * name );
+
+            /**
+            * @brief Acquire a Slot
+            *
+            * Producer only. Waits for a free slot if the ring is full.
+            *
+            * @param timeout The longest to wait.
+            * @return Returns a ByteStreambuf opened for output over the slot, or nullptr if none became free in time.
+            * A slot acquired but not published is acquired again.
+            */
+            ByteStreambuf * acquire( Timeout timeout = Timeout::max() );
+
+            /**
+            * @brief Publish the Acquired Slot
+            *
+            * Producer only. The message length is the put position of the ByteStreambuf returned by acquire.
+            */
+            void publish();
+
+            /**
+            * @brief Close the Channel
+            *
+            * Producer only. Once the consumer has received every message published, receive returns nullptr.
+            */
+            void close();
+
+            /**
+            * @brief Receive a Message
+            *
+            * Consumer only. Waits for a message if the ring is empty. The message remains in its slot until released.
+            *
+            * @param timeout The longest to wait.
+            * @return Returns an InputByteStream, in a good state, over the message, or nullptr if none arrived
+            * in time or the channel is closed and drained. A message received but not released is received again.
+            */
+            InputByteStream * receive( Timeout timeout = Timeout::max() );
+
+            /**
+            * @brief Release the Received Message
+            *
+            * Consumer only. Frees its slot for the producer.
+            */
+            void release();
+
+            /**
+            * @brief Received Message Stream Buffer
+            *
+            * @return Returns the ConstByteStreambuf over the message last received, for use with the serialization
+            * overloads operating directly upon a ByteStreambuf.
+            */
+            ConstByteStreambuf & streambuf() { return _message; }
+
+            /**
+            * @brief File Descriptor
+            *
+            * @return Returns the file descriptor of the channel's memory, for attaching from another process.
+            */
+            int fd() const { return _fd; }
+
+            /**
+            * @brief Slot Size
+            *
+            * @return Returns the largest message a slot holds.
+            */
+            size_t slotSize() const { return _slotSize; }
+
+            /**
+            * @brief Slot Count
+            *
+            * @return Returns the number of slots.
+            */
+            size_t numSlots() const { return _numSlots; }
+
+        private:
+            struct Header;
+
+            void _create( size_t slotSize, size_t numSlots );
+            void _attach();
+            void _unmap();
+            unsigned char * _slot( uint32_t index ) const;
+
+            int _fd{ -1 };
+            unsigned char * _pMemory{ nullptr };
+            size_t _mappedSize{ 0 };
+            Header * _pHeader{ nullptr };
+            size_t _slotSize{ 0 };
+            size_t _slotStride{ 0 };
+            size_t _numSlots{ 0 };
+            ByteStreambuf _slotStreambuf;
+            ConstByteStreambuf _message;
+            InputByteStream _stream;
+            unsigned _spinLimit;
+            bool _acquired{ false };
+            bool _received{ false };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_SHMCHANNEL_H
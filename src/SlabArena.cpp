@@ -0,0 +1,148 @@
+/**
+* @file SlabArena.cpp
+* @brief The Implementation for a NUMA and Huge Page Aware Arena of Fixed Size Blocks
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "SlabArena.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <system_error>
+#include <cerrno>
+
+using namespace ReiserRT::Utility;
+
+constexpr size_t SlabArena::cacheLineSize;
+constexpr size_t SlabArena::hugePageSize;
+constexpr uint32_t SlabArena::emptyIndex;
+
+namespace
+{
+    // From linux/mempolicy.h, which is not included for the sake of the other declarations it brings.
+    constexpr int mpolPreferred = 1;
+
+    constexpr size_t pageSize = 4096;
+}
+
+SlabArena::SlabArena( size_t blockSize, size_t numBlocks )
+  : _head{ uint64_t( emptyIndex ) }
+  , _headPadding{}
+  , _blockSize( ( blockSize + cacheLineSize - 1 ) / cacheLineSize * cacheLineSize )
+  , _blockStride( _blockSize / cacheLineSize % 2 ? _blockSize : _blockSize + cacheLineSize )
+  , _numBlocks( numBlocks )
+{
+    if ( 0 == blockSize || 0 == numBlocks || emptyIndex <= numBlocks )
+        throw std::invalid_argument( "SlabArena: the block size and count must be non-zero and the count less than 2^32 - 1" );
+    if ( ( SIZE_MAX - hugePageSize ) / _blockStride < numBlocks )
+        throw std::invalid_argument( "SlabArena: the slab would be too large" );
+
+    // Chain every block, lowest address first.
+    _next.reset( new std::atomic< uint32_t >[ _numBlocks ] );
+    for ( size_t i = 0; _numBlocks != i; ++i )
+        _next[i].store( _numBlocks - 1 != i ? uint32_t( i + 1 ) : emptyIndex, std::memory_order_relaxed );
+
+    _reserve( ( _blockStride * _numBlocks + hugePageSize - 1 ) / hugePageSize * hugePageSize );
+    _bind();
+    _touch();
+    _head.store( 0, std::memory_order_release );
+}
+
+SlabArena::~SlabArena()
+{
+    munmap( _pMapping, _mappedSize );
+}
+
+unsigned char * SlabArena::allocate()
+{
+    uint64_t head = _head.load( std::memory_order_acquire );
+    for ( ;; )
+    {
+        const uint32_t index = uint32_t( head );
+        if ( emptyIndex == index ) return nullptr;
+
+        const uint64_t next = ( ( head >> 32 ) + 1 ) << 32 | _next[ index ].load( std::memory_order_relaxed );
+        if ( _head.compare_exchange_weak( head, next, std::memory_order_acquire, std::memory_order_acquire ) )
+            return _pSlab + size_t( index ) * _blockStride;
+    }
+}
+
+void SlabArena::deallocate( unsigned char * pBlock )
+{
+    if ( !pBlock ) return;
+
+    const size_t offset = size_t( reinterpret_cast< uintptr_t >( pBlock ) - reinterpret_cast< uintptr_t >( _pSlab ) );
+    if ( _blockStride * _numBlocks <= offset || 0 != offset % _blockStride )
+        throw std::invalid_argument( "SlabArena: the pointer deallocated is not a block of this arena" );
+
+    const uint32_t index = uint32_t( offset / _blockStride );
+    uint64_t head = _head.load( std::memory_order_relaxed );
+    uint64_t next;
+    do
+    {
+        _next[ index ].store( uint32_t( head ), std::memory_order_relaxed );
+        next = ( ( head >> 32 ) + 1 ) << 32 | index;
+    } while ( !_head.compare_exchange_weak( head, next, std::memory_order_release, std::memory_order_relaxed ) );
+}
+
+void SlabArena::_reserve( size_t slabSize )
+{
+    _slabSize = slabSize;
+
+    // Reserved huge pages are used when there are enough of them.
+    void * pMapping = mmap( nullptr, slabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+    if ( MAP_FAILED != pMapping )
+    {
+        _pMapping = pMapping;
+        _mappedSize = slabSize;
+        _pSlab = static_cast< unsigned char * >( pMapping );
+        _hugePages = true;
+        return;
+    }
+
+    // Otherwise, a mapping of normal pages is trimmed to a huge page boundary, so that transparent huge pages may
+    // back all of it.
+    pMapping = mmap( nullptr, slabSize + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( MAP_FAILED == pMapping ) throw std::system_error( errno, std::generic_category(), "SlabArena: mmap" );
+
+    auto pMapped = static_cast< unsigned char * >( pMapping );
+    auto pAligned = reinterpret_cast< unsigned char * >(
+            ( reinterpret_cast< uintptr_t >( pMapped ) + hugePageSize - 1 ) & ~uintptr_t( hugePageSize - 1 ) );
+    const size_t leading = size_t( pAligned - pMapped );
+    if ( 0 != leading ) munmap( pMapped, leading );
+    if ( hugePageSize != leading ) munmap( pAligned + slabSize, hugePageSize - leading );
+
+    _pMapping = pAligned;
+    _mappedSize = slabSize;
+    _pSlab = pAligned;
+#ifdef MADV_HUGEPAGE
+    madvise( pAligned, slabSize, MADV_HUGEPAGE );
+#endif
+}
+
+void SlabArena::_bind()
+{
+#if defined( SYS_getcpu ) && defined( SYS_mbind )
+    // A failure to bind, as where the kernel lacks NUMA support, leaves placement to the first touch.
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if ( 0 != syscall( SYS_getcpu, &cpu, &node, nullptr ) ) return;
+    if ( sizeof( unsigned long ) * 8 - 1 <= node ) return;
+
+    // The preferred policy, rather than strict binding, lets the kernel fall back to another node rather than fail
+    // should the node run short.
+    const unsigned long nodeMask = 1UL << node;
+    if ( 0 != syscall( SYS_mbind, _pSlab, _slabSize, mpolPreferred, &nodeMask, sizeof( nodeMask ) * 8, 0U ) ) return;
+    _numaNode = int( node );
+#endif
+}
+
+void SlabArena::_touch()
+{
+    for ( size_t offset = 0; _slabSize > offset; offset += pageSize )
+        *static_cast< volatile unsigned char * >( _pSlab + offset ) = 0;
+}
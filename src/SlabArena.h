@@ -0,0 +1,186 @@
+/**
+* @file SlabArena.h
+* @brief The Specification for a NUMA and Huge Page Aware Arena of Fixed Size Blocks
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_SLABARENA_H
+#define REISERRT_BYTESTREAMBUF_SLABARENA_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include "ByteStreambuf.h"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Slab Arena
+        *
+        * This class provides the memory a ByteStreambuf, which never owns memory, is constructed over. It reserves
+        * one slab of memory and divides it into fixed size blocks, each aligned to a cache line, which are allocated
+        * and deallocated through a lock free free list, so that any thread may allocate and any thread deallocate.
+        * Blocks are laid out an odd number of cache lines apart, so that the first lines of successive blocks, where
+        * headers are written, fall in different cache sets rather than competing for a few, as they would were
+        * blocks of a power of two size packed together.
+        *
+        * The slab is backed by huge pages where the system has them reserved. Otherwise, it is aligned to the huge
+        * page size and transparent huge pages are requested for it. Either way, far fewer TLB entries cover the blocks
+        * than would cover blocks allocated individually. The slab is bound to the NUMA node of the constructing
+        * thread and every page of it is touched by that thread, so that it is resident, and local, before the first
+        * block is allocated. An arena should therefore be constructed by a thread on the node its blocks will be
+        * used on.
+        *
+        * @code SlabArena arena( 2048, 4096 );
+        * @code unsigned char * pBlock = arena.allocate();
+        * @code ByteStreambuf byteStreambuf = arena.streambuf( pBlock );
+        * @code ...
+        * @code arena.deallocate( pBlock );
+        * @endcode
+        */
+        class ReiserRT_ByteStreambuf_EXPORT SlabArena
+        {
+        public:
+            /**
+            * @brief Cache Line Size
+            *
+            * The alignment of every block, and the granularity block sizes are rounded up to.
+            */
+            static constexpr size_t cacheLineSize = 64;
+
+            /**
+            * @brief Huge Page Size
+            *
+            * The alignment of the slab, and the granularity its size is rounded up to.
+            */
+            static constexpr size_t hugePageSize = size_t( 2 ) << 20;
+
+            /**
+            * @brief Constructor for SlabArena
+            *
+            * Reserves, binds and touches the slab, and places every block on the free list.
+            *
+            * @param blockSize The size of each block, rounded up to a multiple of the cache line size.
+            * @param numBlocks The number of blocks.
+            * @throw Throws std::invalid_argument if either is zero or there are too many blocks.
+            * @throw Throws std::system_error if the slab cannot be reserved.
+            */
+            SlabArena( size_t blockSize, size_t numBlocks );
+
+            /**
+            * @brief Destructor for SlabArena
+            *
+            * Releases the slab. Every block must have been deallocated and every ByteStreambuf over one destroyed.
+            */
+            ~SlabArena();
+
+            SlabArena( const SlabArena & ) = delete;
+            SlabArena & operator=( const SlabArena & ) = delete;
+
+            /**
+            * @brief Allocate a Block
+            *
+            * Lock free. May be invoked concurrently from any thread.
+            *
+            * @return Returns a pointer to a block of blockSize bytes, or nullptr if every block is allocated.
+            */
+            unsigned char * allocate();
+
+            /**
+            * @brief Deallocate a Block
+            *
+            * Lock free. May be invoked concurrently from any thread.
+            *
+            * @param pBlock A block returned by allocate, or nullptr which is ignored.
+            * @throw Throws std::invalid_argument if pBlock is not the start of a block of this arena.
+            */
+            void deallocate( unsigned char * pBlock );
+
+            /**
+            * @brief Construct a ByteStreambuf over a Block
+            *
+            * @param pBlock A block returned by allocate. It remains allocated, and must outlive the ByteStreambuf.
+            * @param openMode The open mode of the ByteStreambuf.
+            * @return Returns a ByteStreambuf spanning the whole block.
+            */
+            ByteStreambuf streambuf( unsigned char * pBlock,
+                                     std::ios_base::openmode openMode = std::ios_base::in | std::ios_base::out ) const
+            {
+                return ByteStreambuf{ pBlock, std::streamsize( _blockSize ), openMode };
+            }
+
+            /**
+            * @brief Block Size
+            *
+            * @return Returns the size of each block, after rounding.
+            */
+            size_t blockSize() const { return _blockSize; }
+
+            /**
+            * @brief Block Stride
+            *
+            * @return Returns the distance between successive blocks, the block size padded to an odd number of
+            * cache lines.
+            */
+            size_t blockStride() const { return _blockStride; }
+
+            /**
+            * @brief Block Count
+            *
+            * @return Returns the number of blocks.
+            */
+            size_t numBlocks() const { return _numBlocks; }
+
+            /**
+            * @brief Huge Page Backing
+            *
+            * @return Returns true if the slab is backed by reserved huge pages, false if transparent huge pages
+            * were merely requested for it.
+            */
+            bool hugePages() const { return _hugePages; }
+
+            /**
+            * @brief NUMA Node
+            *
+            * @return Returns the node the slab was bound to, or -1 if it could not be bound and relies upon
+            * having been first touched by the constructing thread.
+            */
+            int numaNode() const { return _numaNode; }
+
+        private:
+            static constexpr uint32_t emptyIndex = UINT32_MAX;
+
+            void _reserve( size_t slabSize );
+            void _bind();
+            void _touch();
+
+            // The head is the index of the first free block in its low half, and a tag in its high half which is
+            // incremented by every change of it, so that a compare and swap cannot succeed against a head which has
+            // been popped and pushed back since it was read.
+            std::atomic< uint64_t > _head;
+            char _headPadding[ cacheLineSize - sizeof( std::atomic< uint64_t > ) ];
+
+            // The index of the next free block, per block. Kept apart from the blocks so that popping never reads
+            // a block another thread has allocated and is writing.
+            std::unique_ptr< std::atomic< uint32_t >[] > _next;
+            size_t _blockSize;
+            size_t _blockStride;
+            size_t _numBlocks;
+            unsigned char * _pSlab{ nullptr };
+            size_t _slabSize{ 0 };
+            void * _pMapping{ nullptr };
+            size_t _mappedSize{ 0 };
+            bool _hugePages{ false };
+            int _numaNode{ -1 };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_SLABARENA_H
@@ -0,0 +1,543 @@
+/**
+* @file TextTranscoding.cpp
+* @brief The Implementation for Hex and Base64 Transcoding of ByteStreambuf Regions
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "TextTranscoding.h"
+#include "ByteStreambuf.h"
+
+#include <cstdint>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define REISERRT_BYTESTREAMBUF_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    const char hexDigits[] = "0123456789abcdef";
+    const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    // Maps each character to its base64 value, or -1 if it is not in the alphabet.
+    struct Base64DecodeTable
+    {
+        Base64DecodeTable()
+        {
+            for ( auto & value : values ) value = -1;
+            for ( int i = 0; 64 != i; ++i ) values[ static_cast< unsigned char >( base64Alphabet[i] ) ] = int8_t( i );
+        }
+
+        int8_t values[256];
+    };
+
+    const Base64DecodeTable & base64DecodeTable()
+    {
+        static const Base64DecodeTable table;
+        return table;
+    }
+
+    int hexValue( unsigned char c )
+    {
+        const unsigned digit = unsigned( c ) - '0';
+        if ( 10 > digit ) return int( digit );
+        const unsigned letter = unsigned( c | 0x20 ) - 'a';
+        if ( 6 > letter ) return int( letter ) + 10;
+        return -1;
+    }
+
+    void hexEncodeScalar( const unsigned char * pBytes, size_t len, unsigned char * pText )
+    {
+        for ( size_t i = 0; len != i; ++i )
+        {
+            *pText++ = static_cast< unsigned char >( hexDigits[ pBytes[i] >> 4 ] );
+            *pText++ = static_cast< unsigned char >( hexDigits[ pBytes[i] & 0x0F ] );
+        }
+    }
+
+    bool hexDecodeScalar( const unsigned char * pText, size_t numBytes, unsigned char * pBytes )
+    {
+        for ( size_t i = 0; numBytes != i; ++i, pText += 2 )
+        {
+            const int hi = hexValue( pText[0] );
+            const int lo = hexValue( pText[1] );
+            if ( 0 > ( hi | lo ) ) return false;
+            pBytes[i] = static_cast< unsigned char >( hi << 4 | lo );
+        }
+        return true;
+    }
+
+    // Encodes whole groups of three bytes as quads of four characters.
+    void base64EncodeScalar( const unsigned char * pBytes, size_t numGroups, unsigned char * pText )
+    {
+        for ( size_t i = 0; numGroups != i; ++i, pBytes += 3, pText += 4 )
+        {
+            const uint32_t v = uint32_t( pBytes[0] ) << 16 | uint32_t( pBytes[1] ) << 8 | pBytes[2];
+            pText[0] = static_cast< unsigned char >( base64Alphabet[ v >> 18 ] );
+            pText[1] = static_cast< unsigned char >( base64Alphabet[ ( v >> 12 ) & 0x3F ] );
+            pText[2] = static_cast< unsigned char >( base64Alphabet[ ( v >> 6 ) & 0x3F ] );
+            pText[3] = static_cast< unsigned char >( base64Alphabet[ v & 0x3F ] );
+        }
+    }
+
+    // Decodes whole quads of four characters, none of them padding, as groups of three bytes.
+    bool base64DecodeScalar( const unsigned char * pText, size_t numQuads, unsigned char * pBytes )
+    {
+        const int8_t * const values = base64DecodeTable().values;
+        for ( size_t i = 0; numQuads != i; ++i, pText += 4, pBytes += 3 )
+        {
+            const int a = values[ pText[0] ];
+            const int b = values[ pText[1] ];
+            const int c = values[ pText[2] ];
+            const int d = values[ pText[3] ];
+            if ( 0 > ( a | b | c | d ) ) return false;
+            const uint32_t v = uint32_t( a ) << 18 | uint32_t( b ) << 12 | uint32_t( c ) << 6 | uint32_t( d );
+            pBytes[0] = static_cast< unsigned char >( v >> 16 );
+            pBytes[1] = static_cast< unsigned char >( v >> 8 );
+            pBytes[2] = static_cast< unsigned char >( v );
+        }
+        return true;
+    }
+
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    // Each vector kernel processes as many whole blocks as it can and returns how much it processed, leaving
+    // the remainder to a narrower kernel. Decoding kernels stop short of a block holding an invalid character,
+    // leaving the scalar kernel to reject it.
+
+    bool hasAvx2()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports( "avx2" );
+    }
+
+    bool hasSsse3()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports( "ssse3" );
+    }
+
+    __attribute__(( target( "ssse3" ) ))
+    size_t hexEncodeSsse3( const unsigned char * pBytes, size_t len, unsigned char * pText )
+    {
+        const __m128i lut = _mm_loadu_si128( reinterpret_cast< const __m128i * >( hexDigits ) );
+        const __m128i nibble = _mm_set1_epi8( 0x0F );
+        size_t i = 0;
+        for ( ; len - i >= 16; i += 16 )
+        {
+            const __m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i * >( pBytes + i ) );
+            const __m128i hi = _mm_shuffle_epi8( lut, _mm_and_si128( _mm_srli_epi16( v, 4 ), nibble ) );
+            const __m128i lo = _mm_shuffle_epi8( lut, _mm_and_si128( v, nibble ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pText + 2 * i ), _mm_unpacklo_epi8( hi, lo ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pText + 2 * i + 16 ), _mm_unpackhi_epi8( hi, lo ) );
+        }
+        return i;
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    size_t hexEncodeAvx2( const unsigned char * pBytes, size_t len, unsigned char * pText )
+    {
+        const __m256i lut = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128( reinterpret_cast< const __m128i * >( hexDigits ) ) );
+        const __m256i nibble = _mm256_set1_epi8( 0x0F );
+        size_t i = 0;
+        for ( ; len - i >= 32; i += 32 )
+        {
+            const __m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( pBytes + i ) );
+            const __m256i hi = _mm256_shuffle_epi8( lut, _mm256_and_si256( _mm256_srli_epi16( v, 4 ), nibble ) );
+            const __m256i lo = _mm256_shuffle_epi8( lut, _mm256_and_si256( v, nibble ) );
+
+            // Unpacking interleaves within each 128-bit lane, so the lanes are put back in order afterward.
+            const __m256i a = _mm256_unpacklo_epi8( hi, lo );
+            const __m256i b = _mm256_unpackhi_epi8( hi, lo );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( pText + 2 * i ), _mm256_permute2x128_si256( a, b, 0x20 ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( pText + 2 * i + 32 ), _mm256_permute2x128_si256( a, b, 0x31 ) );
+        }
+        return i;
+    }
+
+    // Yields the value of each hex character and a mask of which characters are valid.
+    __attribute__(( target( "ssse3" ) ))
+    __m128i hexValuesSsse3( __m128i c, __m128i & valid )
+    {
+        const __m128i digit = _mm_sub_epi8( c, _mm_set1_epi8( '0' ) );
+        const __m128i isDigit = _mm_cmpeq_epi8( _mm_min_epu8( digit, _mm_set1_epi8( 9 ) ), digit );
+        const __m128i letter = _mm_sub_epi8( _mm_or_si128( c, _mm_set1_epi8( 0x20 ) ), _mm_set1_epi8( 'a' ) );
+        const __m128i isLetter = _mm_cmpeq_epi8( _mm_min_epu8( letter, _mm_set1_epi8( 5 ) ), letter );
+        valid = _mm_or_si128( isDigit, isLetter );
+        return _mm_or_si128( _mm_and_si128( isDigit, digit ),
+                             _mm_and_si128( isLetter, _mm_add_epi8( letter, _mm_set1_epi8( 10 ) ) ) );
+    }
+
+    __attribute__(( target( "ssse3" ) ))
+    size_t hexDecodeSsse3( const unsigned char * pText, size_t numBytes, unsigned char * pBytes )
+    {
+        const __m128i weights = _mm_set1_epi16( 0x0110 );
+        size_t i = 0;
+        for ( ; numBytes - i >= 16; i += 16 )
+        {
+            __m128i validA, validB;
+            const __m128i a = hexValuesSsse3(
+                _mm_loadu_si128( reinterpret_cast< const __m128i * >( pText + 2 * i ) ), validA );
+            const __m128i b = hexValuesSsse3(
+                _mm_loadu_si128( reinterpret_cast< const __m128i * >( pText + 2 * i + 16 ) ), validB );
+            if ( 0xFFFF != _mm_movemask_epi8( _mm_and_si128( validA, validB ) ) ) break;
+
+            // Each pair of nibbles becomes a 16-bit word of high * 16 + low, then the words are narrowed to bytes.
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pBytes + i ),
+                              _mm_packus_epi16( _mm_maddubs_epi16( a, weights ), _mm_maddubs_epi16( b, weights ) ) );
+        }
+        return i;
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    __m256i hexValuesAvx2( __m256i c, __m256i & valid )
+    {
+        const __m256i digit = _mm256_sub_epi8( c, _mm256_set1_epi8( '0' ) );
+        const __m256i isDigit = _mm256_cmpeq_epi8( _mm256_min_epu8( digit, _mm256_set1_epi8( 9 ) ), digit );
+        const __m256i letter = _mm256_sub_epi8( _mm256_or_si256( c, _mm256_set1_epi8( 0x20 ) ), _mm256_set1_epi8( 'a' ) );
+        const __m256i isLetter = _mm256_cmpeq_epi8( _mm256_min_epu8( letter, _mm256_set1_epi8( 5 ) ), letter );
+        valid = _mm256_or_si256( isDigit, isLetter );
+        return _mm256_or_si256( _mm256_and_si256( isDigit, digit ),
+                                _mm256_and_si256( isLetter, _mm256_add_epi8( letter, _mm256_set1_epi8( 10 ) ) ) );
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    size_t hexDecodeAvx2( const unsigned char * pText, size_t numBytes, unsigned char * pBytes )
+    {
+        const __m256i weights = _mm256_set1_epi16( 0x0110 );
+        size_t i = 0;
+        for ( ; numBytes - i >= 32; i += 32 )
+        {
+            __m256i validA, validB;
+            const __m256i a = hexValuesAvx2(
+                _mm256_loadu_si256( reinterpret_cast< const __m256i * >( pText + 2 * i ) ), validA );
+            const __m256i b = hexValuesAvx2(
+                _mm256_loadu_si256( reinterpret_cast< const __m256i * >( pText + 2 * i + 32 ) ), validB );
+            if ( -1 != _mm256_movemask_epi8( _mm256_and_si256( validA, validB ) ) ) break;
+
+            // Packing narrows within each 128-bit lane, so the 64-bit quarters are put back in order afterward.
+            const __m256i packed = _mm256_packus_epi16( _mm256_maddubs_epi16( a, weights ),
+                                                        _mm256_maddubs_epi16( b, weights ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( pBytes + i ), _mm256_permute4x64_epi64( packed, 0xD8 ) );
+        }
+        return i;
+    }
+
+    // The base64 kernels follow Wojciech Muła's and Daniel Lemire's published vectorizations. Three bytes are
+    // spread across a 32-bit lane and their four 6-bit fields isolated with multiplies in place of variable shifts.
+    // Fields are mapped to and from characters by adding an offset looked up per range of the alphabet.
+
+    __attribute__(( target( "ssse3" ) ))
+    size_t base64EncodeSsse3( const unsigned char * pBytes, size_t numGroups, unsigned char * pText )
+    {
+        const __m128i spread = _mm_setr_epi8( 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 );
+        const __m128i offsets = _mm_setr_epi8( 65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0 );
+        size_t g = 0;
+
+        // Sixteen bytes are loaded for twelve used.
+        for ( ; numGroups - g >= 6; g += 4 )
+        {
+            __m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i * >( pBytes + 3 * g ) );
+            v = _mm_shuffle_epi8( v, spread );
+            const __m128i ac = _mm_mulhi_epu16( _mm_and_si128( v, _mm_set1_epi32( 0x0FC0FC00 ) ),
+                                                _mm_set1_epi32( 0x04000040 ) );
+            const __m128i bd = _mm_mullo_epi16( _mm_and_si128( v, _mm_set1_epi32( 0x003F03F0 ) ),
+                                                _mm_set1_epi32( 0x01000010 ) );
+            const __m128i fields = _mm_or_si128( ac, bd );
+
+            __m128i range = _mm_subs_epu8( fields, _mm_set1_epi8( 51 ) );
+            range = _mm_sub_epi8( range, _mm_cmpgt_epi8( fields, _mm_set1_epi8( 25 ) ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pText + 4 * g ),
+                              _mm_add_epi8( fields, _mm_shuffle_epi8( offsets, range ) ) );
+        }
+        return g;
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    size_t base64EncodeAvx2( const unsigned char * pBytes, size_t numGroups, unsigned char * pText )
+    {
+        const __m256i spread = _mm256_setr_epi8( 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 );
+        const __m256i offsets = _mm256_setr_epi8( 65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                                                  65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0 );
+        size_t g = 0;
+
+        // Each lane is loaded with sixteen bytes for twelve used, the second lane overlapping the first.
+        for ( ; numGroups - g >= 10; g += 8 )
+        {
+            const unsigned char * p = pBytes + 3 * g;
+            __m256i v = _mm256_inserti128_si256(
+                _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ) ),
+                _mm_loadu_si128( reinterpret_cast< const __m128i * >( p + 12 ) ), 1 );
+            v = _mm256_shuffle_epi8( v, spread );
+            const __m256i ac = _mm256_mulhi_epu16( _mm256_and_si256( v, _mm256_set1_epi32( 0x0FC0FC00 ) ),
+                                                   _mm256_set1_epi32( 0x04000040 ) );
+            const __m256i bd = _mm256_mullo_epi16( _mm256_and_si256( v, _mm256_set1_epi32( 0x003F03F0 ) ),
+                                                   _mm256_set1_epi32( 0x01000010 ) );
+            const __m256i fields = _mm256_or_si256( ac, bd );
+
+            __m256i range = _mm256_subs_epu8( fields, _mm256_set1_epi8( 51 ) );
+            range = _mm256_sub_epi8( range, _mm256_cmpgt_epi8( fields, _mm256_set1_epi8( 25 ) ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( pText + 4 * g ),
+                                 _mm256_add_epi8( fields, _mm256_shuffle_epi8( offsets, range ) ) );
+        }
+        return g;
+    }
+
+    __attribute__(( target( "ssse3" ) ))
+    size_t base64DecodeSsse3( const unsigned char * pText, size_t numQuads, unsigned char * pBytes )
+    {
+        // Character classes by low and high nibble. A character is valid when its two class masks are disjoint.
+        const __m128i classLo = _mm_setr_epi8( 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                               0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A );
+        const __m128i classHi = _mm_setr_epi8( 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 );
+        const __m128i offsets = _mm_setr_epi8( 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 );
+        const __m128i gather = _mm_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 );
+        const __m128i nibble = _mm_set1_epi8( 0x0F );
+        size_t q = 0;
+
+        // Sixteen bytes are stored for twelve produced.
+        for ( ; numQuads - q >= 6; q += 4 )
+        {
+            const __m128i c = _mm_loadu_si128( reinterpret_cast< const __m128i * >( pText + 4 * q ) );
+            const __m128i hiNibbles = _mm_and_si128( _mm_srli_epi32( c, 4 ), nibble );
+            const __m128i invalid = _mm_and_si128( _mm_shuffle_epi8( classLo, _mm_and_si128( c, nibble ) ),
+                                                   _mm_shuffle_epi8( classHi, hiNibbles ) );
+            if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi8( invalid, _mm_setzero_si128() ) ) ) break;
+
+            const __m128i isSlash = _mm_cmpeq_epi8( c, _mm_set1_epi8( '/' ) );
+            const __m128i fields = _mm_add_epi8( c, _mm_shuffle_epi8( offsets, _mm_add_epi8( isSlash, hiNibbles ) ) );
+            const __m128i pairs = _mm_maddubs_epi16( fields, _mm_set1_epi32( 0x01400140 ) );
+            const __m128i groups = _mm_madd_epi16( pairs, _mm_set1_epi32( 0x00011000 ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( pBytes + 3 * q ), _mm_shuffle_epi8( groups, gather ) );
+        }
+        return q;
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    size_t base64DecodeAvx2( const unsigned char * pText, size_t numQuads, unsigned char * pBytes )
+    {
+        const __m256i classLo = _mm256_setr_epi8( 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                  0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                  0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A );
+        const __m256i classHi = _mm256_setr_epi8( 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                  0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 );
+        const __m256i offsets = _mm256_setr_epi8( 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 );
+        const __m256i gather = _mm256_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 );
+        const __m256i compact = _mm256_setr_epi32( 0, 1, 2, 4, 5, 6, 7, 7 );
+        const __m256i nibble = _mm256_set1_epi8( 0x0F );
+        size_t q = 0;
+
+        // Thirty two bytes are stored for twenty four produced.
+        for ( ; numQuads - q >= 11; q += 8 )
+        {
+            const __m256i c = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( pText + 4 * q ) );
+            const __m256i hiNibbles = _mm256_and_si256( _mm256_srli_epi32( c, 4 ), nibble );
+            const __m256i invalid = _mm256_and_si256( _mm256_shuffle_epi8( classLo, _mm256_and_si256( c, nibble ) ),
+                                                      _mm256_shuffle_epi8( classHi, hiNibbles ) );
+            if ( !_mm256_testz_si256( invalid, invalid ) ) break;
+
+            const __m256i isSlash = _mm256_cmpeq_epi8( c, _mm256_set1_epi8( '/' ) );
+            const __m256i fields = _mm256_add_epi8( c, _mm256_shuffle_epi8( offsets,
+                                                                            _mm256_add_epi8( isSlash, hiNibbles ) ) );
+            const __m256i pairs = _mm256_maddubs_epi16( fields, _mm256_set1_epi32( 0x01400140 ) );
+            const __m256i groups = _mm256_madd_epi16( pairs, _mm256_set1_epi32( 0x00011000 ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( pBytes + 3 * q ),
+                                 _mm256_permutevar8x32_epi32( _mm256_shuffle_epi8( groups, gather ), compact ) );
+        }
+        return q;
+    }
+#endif
+
+    void hexEncode( const unsigned char * pBytes, size_t len, unsigned char * pText )
+    {
+        size_t done = 0;
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+        if ( TextTranscoding::usingAvx2() ) done = hexEncodeAvx2( pBytes, len, pText );
+        if ( TextTranscoding::usingSsse3() ) done += hexEncodeSsse3( pBytes + done, len - done, pText + 2 * done );
+#endif
+        hexEncodeScalar( pBytes + done, len - done, pText + 2 * done );
+    }
+
+    bool hexDecode( const unsigned char * pText, size_t numBytes, unsigned char * pBytes )
+    {
+        size_t done = 0;
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+        if ( TextTranscoding::usingAvx2() ) done = hexDecodeAvx2( pText, numBytes, pBytes );
+        if ( TextTranscoding::usingSsse3() ) done += hexDecodeSsse3( pText + 2 * done, numBytes - done, pBytes + done );
+#endif
+        return hexDecodeScalar( pText + 2 * done, numBytes - done, pBytes + done );
+    }
+
+    void base64Encode( const unsigned char * pBytes, size_t len, unsigned char * pText )
+    {
+        const size_t numGroups = len / 3;
+        size_t done = 0;
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+        if ( TextTranscoding::usingAvx2() ) done = base64EncodeAvx2( pBytes, numGroups, pText );
+        if ( TextTranscoding::usingSsse3() )
+            done += base64EncodeSsse3( pBytes + 3 * done, numGroups - done, pText + 4 * done );
+#endif
+        base64EncodeScalar( pBytes + 3 * done, numGroups - done, pText + 4 * done );
+
+        // A final one or two bytes are padded.
+        const size_t remaining = len - 3 * numGroups;
+        if ( 0 == remaining ) return;
+        pBytes += 3 * numGroups;
+        pText += 4 * numGroups;
+        const uint32_t v = uint32_t( pBytes[0] ) << 16 | ( 2 == remaining ? uint32_t( pBytes[1] ) << 8 : 0 );
+        pText[0] = static_cast< unsigned char >( base64Alphabet[ v >> 18 ] );
+        pText[1] = static_cast< unsigned char >( base64Alphabet[ ( v >> 12 ) & 0x3F ] );
+        pText[2] = static_cast< unsigned char >( 2 == remaining ? base64Alphabet[ ( v >> 6 ) & 0x3F ] : '=' );
+        pText[3] = '=';
+    }
+
+    // The number of bytes a base64 text decodes to, or zero if its length or padding is not valid.
+    size_t base64DecodedSize( const unsigned char * pText, size_t len )
+    {
+        if ( 0 == len || 0 != len % 4 ) return 0;
+        const size_t padding = '=' != pText[ len - 1 ] ? 0 : '=' != pText[ len - 2 ] ? 1 : 2;
+        return len / 4 * 3 - padding;
+    }
+
+    bool base64Decode( const unsigned char * pText, unsigned char * pBytes, size_t numBytes )
+    {
+        const size_t numQuads = numBytes / 3;
+        size_t done = 0;
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+        if ( TextTranscoding::usingAvx2() ) done = base64DecodeAvx2( pText, numQuads, pBytes );
+        if ( TextTranscoding::usingSsse3() )
+            done += base64DecodeSsse3( pText + 4 * done, numQuads - done, pBytes + 3 * done );
+#endif
+        if ( !base64DecodeScalar( pText + 4 * done, numQuads - done, pBytes + 3 * done ) ) return false;
+
+        // A final quad with padding yields one or two bytes.
+        const size_t remaining = numBytes - 3 * numQuads;
+        if ( 0 == remaining ) return true;
+        pText += 4 * numQuads;
+        pBytes += 3 * numQuads;
+        const int8_t * const values = base64DecodeTable().values;
+        const int a = values[ pText[0] ];
+        const int b = values[ pText[1] ];
+        const int c = 2 == remaining ? values[ pText[2] ] : 0;
+        if ( 0 > ( a | b | c ) ) return false;
+        const uint32_t v = uint32_t( a ) << 18 | uint32_t( b ) << 12 | uint32_t( c ) << 6;
+        pBytes[0] = static_cast< unsigned char >( v >> 16 );
+        if ( 2 == remaining ) pBytes[1] = static_cast< unsigned char >( v >> 8 );
+        return true;
+    }
+}
+
+size_t TextTranscoding::hexEncode( const unsigned char * pBytes, size_t len, ByteStreambuf & out )
+{
+    unsigned char * pText = out.claimPutBytes( hexEncodedSize( len ) );
+    if ( !pText ) return 0;
+
+    ::hexEncode( pBytes, len, pText );
+    return hexEncodedSize( len );
+}
+
+size_t TextTranscoding::hexEncodeReadable( ByteStreambuf & in, ByteStreambuf & out )
+{
+    const size_t len = size_t( in.getAreaEnd() - in.position().pGet );
+    const size_t written = hexEncode( in.position().pGet, len, out );
+    if ( 0 != written ) in.claimGetBytes( len );
+    return written;
+}
+
+size_t TextTranscoding::hexEncodeWritten( const ByteStreambuf & in, ByteStreambuf & out )
+{
+    return hexEncode( in.putAreaBegin(), size_t( in.position().pPut - in.putAreaBegin() ), out );
+}
+
+size_t TextTranscoding::hexDecode( const unsigned char * pText, size_t len, ByteStreambuf & out )
+{
+    if ( 0 != len % 2 ) return 0;
+    const ByteStreambuf::Position pos = out.position();
+    unsigned char * pBytes = out.claimPutBytes( len / 2 );
+    if ( !pBytes ) return 0;
+
+    if ( ::hexDecode( pText, len / 2, pBytes ) ) return len / 2;
+    out.restore( pos );
+    return 0;
+}
+
+size_t TextTranscoding::hexDecodeReadable( ByteStreambuf & in, ByteStreambuf & out )
+{
+    const size_t len = size_t( in.getAreaEnd() - in.position().pGet );
+    const size_t written = hexDecode( in.position().pGet, len, out );
+    if ( 0 != written ) in.claimGetBytes( len );
+    return written;
+}
+
+size_t TextTranscoding::base64Encode( const unsigned char * pBytes, size_t len, ByteStreambuf & out )
+{
+    unsigned char * pText = out.claimPutBytes( base64EncodedSize( len ) );
+    if ( !pText ) return 0;
+
+    ::base64Encode( pBytes, len, pText );
+    return base64EncodedSize( len );
+}
+
+size_t TextTranscoding::base64EncodeReadable( ByteStreambuf & in, ByteStreambuf & out )
+{
+    const size_t len = size_t( in.getAreaEnd() - in.position().pGet );
+    const size_t written = base64Encode( in.position().pGet, len, out );
+    if ( 0 != written ) in.claimGetBytes( len );
+    return written;
+}
+
+size_t TextTranscoding::base64EncodeWritten( const ByteStreambuf & in, ByteStreambuf & out )
+{
+    return base64Encode( in.putAreaBegin(), size_t( in.position().pPut - in.putAreaBegin() ), out );
+}
+
+size_t TextTranscoding::base64Decode( const unsigned char * pText, size_t len, ByteStreambuf & out )
+{
+    const size_t numBytes = base64DecodedSize( pText, len );
+    if ( 0 == numBytes ) return 0;
+    const ByteStreambuf::Position pos = out.position();
+    unsigned char * pBytes = out.claimPutBytes( numBytes );
+    if ( !pBytes ) return 0;
+
+    if ( ::base64Decode( pText, pBytes, numBytes ) ) return numBytes;
+    out.restore( pos );
+    return 0;
+}
+
+size_t TextTranscoding::base64DecodeReadable( ByteStreambuf & in, ByteStreambuf & out )
+{
+    const size_t len = size_t( in.getAreaEnd() - in.position().pGet );
+    const size_t written = base64Decode( in.position().pGet, len, out );
+    if ( 0 != written ) in.claimGetBytes( len );
+    return written;
+}
+
+bool TextTranscoding::usingAvx2()
+{
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    static const bool avx2 = hasAvx2();
+    return avx2;
+#else
+    return false;
+#endif
+}
+
+bool TextTranscoding::usingSsse3()
+{
+#ifdef REISERRT_BYTESTREAMBUF_X86_DISPATCH
+    static const bool ssse3 = hasSsse3();
+    return ssse3;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,178 @@
+/**
+* @file TextTranscoding.h
+* @brief The Specification for Hex and Base64 Transcoding of ByteStreambuf Regions
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_TEXTTRANSCODING_H
+#define REISERRT_BYTESTREAMBUF_TEXTTRANSCODING_H
+
+#include "ReiserRT_ByteStreambufExport.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        class ByteStreambuf;
+
+        /**
+        * @brief Hex and Base64 Transcoding
+        *
+        * This class encodes binary bytes as text, for logging or for transports which only carry text, and decodes
+        * such text back into bytes. Output is written directly into a ByteStreambuf put area. The input may be
+        * a plain region of memory, the readable remainder of a ByteStreambuf get area, which is consumed, or what has
+        * been written to a ByteStreambuf put area, which is not.
+        *
+        * Hex is encoded as lowercase and decoded from either case. Base64 uses the standard alphabet of RFC 4648
+        * with padding, and decoding requires it.
+        *
+        * Each operation uses AVX2 or SSSE3 instructions when the processor has them, as detected at run time,
+        * and a portable implementation otherwise. Each is all or nothing. If the output does not fit, or the input
+        * is not valid, no position is advanced and zero is returned.
+        */
+        class ReiserRT_ByteStreambuf_EXPORT TextTranscoding
+        {
+        public:
+            /**
+            * @brief Hex Encoded Size
+            *
+            * @param len The number of bytes to be encoded.
+            * @return Returns the number of characters their hex encoding takes.
+            */
+            static constexpr size_t hexEncodedSize( size_t len ) { return 2 * len; }
+
+            /**
+            * @brief Base64 Encoded Size
+            *
+            * @param len The number of bytes to be encoded.
+            * @return Returns the number of characters their base64 encoding takes, including padding.
+            */
+            static constexpr size_t base64EncodedSize( size_t len ) { return ( len + 2 ) / 3 * 4; }
+
+            /**
+            * @brief Hex Encode
+            *
+            * @param pBytes The bytes.
+            * @param len The number of bytes.
+            * @param out The ByteStreambuf whose put area the characters are written to.
+            * @return Returns the number of characters written, or zero.
+            */
+            static size_t hexEncode( const unsigned char * pBytes, size_t len, ByteStreambuf & out );
+
+            /**
+            * @brief Hex Encode the Readable Bytes
+            *
+            * Encodes and consumes what remains in the get area of the input.
+            *
+            * @param in The ByteStreambuf whose get area is read.
+            * @param out The ByteStreambuf whose put area the characters are written to.
+            * @return Returns the number of characters written, or zero.
+            */
+            static size_t hexEncodeReadable( ByteStreambuf & in, ByteStreambuf & out );
+
+            /**
+            * @brief Hex Encode the Written Bytes
+            *
+            * Encodes what has been written to the put area of the input.
+            *
+            * @param in The ByteStreambuf whose put area is read.
+            * @param out The ByteStreambuf whose put area the characters are written to.
+            * @return Returns the number of characters written, or zero.
+            */
+            static size_t hexEncodeWritten( const ByteStreambuf & in, ByteStreambuf & out );
+
+            /**
+            * @brief Hex Decode
+            *
+            * @param pText The characters.
+            * @param len The number of characters, which must be even.
+            * @param out The ByteStreambuf whose put area the bytes are written to.
+            * @return Returns the number of bytes written, or zero if the text is not valid hex or does not fit.
+            */
+            static size_t hexDecode( const unsigned char * pText, size_t len, ByteStreambuf & out );
+
+            /**
+            * @brief Hex Decode the Readable Characters
+            *
+            * Decodes and, if valid, consumes what remains in the get area of the input.
+            *
+            * @param in The ByteStreambuf whose get area is read.
+            * @param out The ByteStreambuf whose put area the bytes are written to.
+            * @return Returns the number of bytes written, or zero if the text is not valid hex or does not fit.
+            */
+            static size_t hexDecodeReadable( ByteStreambuf & in, ByteStreambuf & out );
+
+            /**
+            * @brief Base64 Encode
+            *
+            * @param pBytes The bytes.
+            * @param len The number of bytes.
+            * @param out The ByteStreambuf whose put area the characters are written to.
+            * @return Returns the number of characters written, or zero.
+            */
+            static size_t base64Encode( const unsigned char * pBytes, size_t len, ByteStreambuf & out );
+
+            /**
+            * @brief Base64 Encode the Readable Bytes
+            *
+            * Encodes and consumes what remains in the get area of the input.
+            *
+            * @param in The ByteStreambuf whose get area is read.
+            * @param out The ByteStreambuf whose put area the characters are written to.
+            * @return Returns the number of characters written, or zero.
+            */
+            static size_t base64EncodeReadable( ByteStreambuf & in, ByteStreambuf & out );
+
+            /**
+            * @brief Base64 Encode the Written Bytes
+            *
+            * Encodes what has been written to the put area of the input.
+            *
+            * @param in The ByteStreambuf whose put area is read.
+            * @param out The ByteStreambuf whose put area the characters are written to.
+            * @return Returns the number of characters written, or zero.
+            */
+            static size_t base64EncodeWritten( const ByteStreambuf & in, ByteStreambuf & out );
+
+            /**
+            * @brief Base64 Decode
+            *
+            * @param pText The characters.
+            * @param len The number of characters, which must be a multiple of four.
+            * @param out The ByteStreambuf whose put area the bytes are written to.
+            * @return Returns the number of bytes written, or zero if the text is not valid base64 or does not fit.
+            */
+            static size_t base64Decode( const unsigned char * pText, size_t len, ByteStreambuf & out );
+
+            /**
+            * @brief Base64 Decode the Readable Characters
+            *
+            * Decodes and, if valid, consumes what remains in the get area of the input.
+            *
+            * @param in The ByteStreambuf whose get area is read.
+            * @param out The ByteStreambuf whose put area the bytes are written to.
+            * @return Returns the number of bytes written, or zero if the text is not valid base64 or does not fit.
+            */
+            static size_t base64DecodeReadable( ByteStreambuf & in, ByteStreambuf & out );
+
+            /**
+            * @brief AVX2 Query
+            *
+            * @return Returns true if transcoding uses AVX2 instructions.
+            */
+            static bool usingAvx2();
+
+            /**
+            * @brief SSSE3 Query
+            *
+            * @return Returns true if transcoding uses SSSE3 instructions.
+            */
+            static bool usingSsse3();
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_TEXTTRANSCODING_H
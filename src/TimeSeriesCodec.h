@@ -0,0 +1,298 @@
+/**
+* @file TimeSeriesCodec.h
+* @brief Gorilla Style Delta of Delta and XOR Encoding of Time Series upon a ByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#ifndef REISERRT_BYTESTREAMBUF_TIMESERIESCODEC_H
+#define REISERRT_BYTESTREAMBUF_TIMESERIESCODEC_H
+
+#include "BitStream.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace ReiserRT
+{
+    namespace Utility
+    {
+        /**
+        * @brief Delta of Delta Integer Encoder
+        *
+        * This class encodes a series of 64-bit integers, such as monotonically increasing timestamps, as the
+        * difference between successive deltas. The first value is written in full. Each subsequent value is written
+        * as a variable length prefix code followed by its delta of delta as a two's complement bit field:
+        * @li '0' for a delta of delta of zero.
+        * @li '10' followed by 7 bits for values within [-64, 63].
+        * @li '110' followed by 9 bits for values within [-256, 255].
+        * @li '1110' followed by 12 bits for values within [-2048, 2047].
+        * @li '1111' followed by 64 bits otherwise.
+        *
+        * A regularly sampled series costs a single bit per value. The number of values is not recorded, so the
+        * decoder must be told it, for instance by serializing the count ahead of the bit packed block.
+        */
+        class DeltaOfDeltaEncoder
+        {
+        public:
+            /**
+            * @brief Constructor for DeltaOfDeltaEncoder
+            *
+            * @param bitWriter The bit writer encoded values are written to. It must out live this object.
+            */
+            explicit DeltaOfDeltaEncoder( BitWriter & bitWriter ) : _bitWriter( bitWriter ) {}
+
+            /**
+            * @brief Encode the Next Value
+            *
+            * @param value The value to encode.
+            */
+            void encode( int64_t value )
+            {
+                const uint64_t v = uint64_t( value );
+                if ( _first )
+                {
+                    _bitWriter.writeBits( v, 64 );
+                    _first = false;
+                }
+                else
+                {
+                    // Unsigned arithmetic avoids undefined behavior upon wrap around.
+                    const uint64_t delta = v - _prevValue;
+                    const int64_t dod = int64_t( delta - _prevDelta );
+                    if ( 0 == dod )
+                        _bitWriter.writeBits( 0x0, 1 );
+                    else if ( -64 <= dod && 63 >= dod )
+                        _bitWriter.writeBits( ( uint64_t( 0x2 ) << 7 ) | ( uint64_t( dod ) & 0x7F ), 9 );
+                    else if ( -256 <= dod && 255 >= dod )
+                        _bitWriter.writeBits( ( uint64_t( 0x6 ) << 9 ) | ( uint64_t( dod ) & 0x1FF ), 12 );
+                    else if ( -2048 <= dod && 2047 >= dod )
+                        _bitWriter.writeBits( ( uint64_t( 0xE ) << 12 ) | ( uint64_t( dod ) & 0xFFF ), 16 );
+                    else
+                    {
+                        _bitWriter.writeBits( 0xF, 4 );
+                        _bitWriter.writeBits( uint64_t( dod ), 64 );
+                    }
+                    _prevDelta = delta;
+                }
+                _prevValue = v;
+            }
+
+        private:
+            BitWriter & _bitWriter;
+            uint64_t _prevValue{ 0 };
+            uint64_t _prevDelta{ 0 };
+            bool _first{ true };
+        };
+
+        /**
+        * @brief Delta of Delta Integer Decoder
+        *
+        * This class decodes a series encoded by DeltaOfDeltaEncoder.
+        */
+        class DeltaOfDeltaDecoder
+        {
+        public:
+            /**
+            * @brief Constructor for DeltaOfDeltaDecoder
+            *
+            * @param bitReader The bit reader encoded values are read from. It must out live this object.
+            */
+            explicit DeltaOfDeltaDecoder( BitReader & bitReader ) : _bitReader( bitReader ) {}
+
+            /**
+            * @brief Decode the Next Value
+            *
+            * @param value The value decoded.
+            * @return Returns false if the bits ran out.
+            */
+            bool decode( int64_t & value )
+            {
+                uint64_t bits;
+                if ( _first )
+                {
+                    if ( !_bitReader.readBits( 64, bits ) ) return false;
+                    _prevValue = bits;
+                    _first = false;
+                }
+                else
+                {
+                    // Count the leading one bits of the prefix, at most four.
+                    unsigned ones = 0;
+                    bool bit = true;
+                    while ( 4 != ones )
+                    {
+                        if ( !_bitReader.readBit( bit ) ) return false;
+                        if ( !bit ) break;
+                        ++ones;
+                    }
+
+                    static const unsigned widths[] = { 0, 7, 9, 12, 64 };
+                    const unsigned width = widths[ ones ];
+                    uint64_t dod = 0;
+                    if ( width )
+                    {
+                        if ( !_bitReader.readBits( width, dod ) ) return false;
+                        // Sign extend.
+                        if ( 64 != width && ( dod >> ( width - 1 ) ) ) dod |= ~uint64_t( 0 ) << width;
+                    }
+                    _prevDelta += dod;
+                    _prevValue += _prevDelta;
+                }
+                value = int64_t( _prevValue );
+                return true;
+            }
+
+        private:
+            BitReader & _bitReader;
+            uint64_t _prevValue{ 0 };
+            uint64_t _prevDelta{ 0 };
+            bool _first{ true };
+        };
+
+        /**
+        * @brief XOR Floating Point Encoder
+        *
+        * This class encodes a series of doubles by XOR with the previous value. The first value is written in full.
+        * Each subsequent value is written as:
+        * @li '0' if it is identical to the previous value.
+        * @li '10' followed by the meaningful bits of the XOR, if they lie within the previous meaningful bit window.
+        * @li '11' followed by a 5-bit leading zero count, a 6-bit meaningful bit count less one and
+        * the meaningful bits of the XOR otherwise.
+        *
+        * Slowly changing samples share their sign, exponent and high mantissa bits and so cost far fewer
+        * than 64 bits each. The number of values is not recorded.
+        */
+        class XorFloatEncoder
+        {
+        public:
+            /**
+            * @brief Constructor for XorFloatEncoder
+            *
+            * @param bitWriter The bit writer encoded values are written to. It must out live this object.
+            */
+            explicit XorFloatEncoder( BitWriter & bitWriter ) : _bitWriter( bitWriter ) {}
+
+            /**
+            * @brief Encode the Next Value
+            *
+            * @param value The value to encode.
+            */
+            void encode( double value )
+            {
+                uint64_t v;
+                memcpy( &v, &value, sizeof( v ) );
+                if ( _first )
+                {
+                    _bitWriter.writeBits( v, 64 );
+                    _first = false;
+                }
+                else
+                {
+                    const uint64_t x = v ^ _prevValue;
+                    if ( 0 == x ) _bitWriter.writeBits( 0x0, 1 );
+                    else
+                    {
+                        unsigned leading = unsigned( __builtin_clzll( x ) );
+                        const unsigned trailing = unsigned( __builtin_ctzll( x ) );
+                        if ( 31 < leading ) leading = 31;
+
+                        if ( _windowValid && leading >= _prevLeading && trailing >= _prevTrailing )
+                        {
+                            _bitWriter.writeBits( 0x2, 2 );
+                            _bitWriter.writeBits( x >> _prevTrailing, 64 - _prevLeading - _prevTrailing );
+                        }
+                        else
+                        {
+                            const unsigned meaningful = 64 - leading - trailing;
+                            _bitWriter.writeBits( ( uint64_t( 0x3 ) << 11 ) | ( leading << 6 ) | ( meaningful - 1 ),
+                                                  13 );
+                            _bitWriter.writeBits( x >> trailing, meaningful );
+                            _prevLeading = leading;
+                            _prevTrailing = trailing;
+                            _windowValid = true;
+                        }
+                    }
+                }
+                _prevValue = v;
+            }
+
+        private:
+            BitWriter & _bitWriter;
+            uint64_t _prevValue{ 0 };
+            unsigned _prevLeading{ 0 };
+            unsigned _prevTrailing{ 0 };
+            bool _windowValid{ false };
+            bool _first{ true };
+        };
+
+        /**
+        * @brief XOR Floating Point Decoder
+        *
+        * This class decodes a series encoded by XorFloatEncoder.
+        */
+        class XorFloatDecoder
+        {
+        public:
+            /**
+            * @brief Constructor for XorFloatDecoder
+            *
+            * @param bitReader The bit reader encoded values are read from. It must out live this object.
+            */
+            explicit XorFloatDecoder( BitReader & bitReader ) : _bitReader( bitReader ) {}
+
+            /**
+            * @brief Decode the Next Value
+            *
+            * @param value The value decoded.
+            * @return Returns false if the bits ran out or the encoding is malformed.
+            */
+            bool decode( double & value )
+            {
+                uint64_t bits;
+                if ( _first )
+                {
+                    if ( !_bitReader.readBits( 64, bits ) ) return false;
+                    _prevValue = bits;
+                    _first = false;
+                }
+                else
+                {
+                    bool bit;
+                    if ( !_bitReader.readBit( bit ) ) return false;
+                    if ( bit )
+                    {
+                        if ( !_bitReader.readBit( bit ) ) return false;
+                        if ( bit )
+                        {
+                            uint64_t header;
+                            if ( !_bitReader.readBits( 11, header ) ) return false;
+                            const unsigned leading = unsigned( header >> 6 );
+                            const unsigned meaningful = unsigned( header & 0x3F ) + 1;
+                            if ( 64 < leading + meaningful ) return false;
+                            _prevLeading = leading;
+                            _prevTrailing = 64 - leading - meaningful;
+                            _windowValid = true;
+                        }
+                        else if ( !_windowValid ) return false;
+
+                        if ( !_bitReader.readBits( 64 - _prevLeading - _prevTrailing, bits ) ) return false;
+                        _prevValue ^= bits << _prevTrailing;
+                    }
+                }
+                memcpy( &value, &_prevValue, sizeof( value ) );
+                return true;
+            }
+
+        private:
+            BitReader & _bitReader;
+            uint64_t _prevValue{ 0 };
+            unsigned _prevLeading{ 0 };
+            unsigned _prevTrailing{ 0 };
+            bool _windowValid{ false };
+            bool _first{ true };
+        };
+    }
+}
+
+#endif //REISERRT_BYTESTREAMBUF_TIMESERIESCODEC_H
@@ -10,6 +10,9 @@
 unsigned char testData[16] = { 0x42, 0x41, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
+const unsigned char constTestData[16] = { 0x42, 0x41, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+                                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 const unsigned short uShortTestVal1 = 0x4241;
 const unsigned short uShortTestVal2 = 0x8040;
 const signed short sShortTestVal = (signed short)0x4241;
@@ -12,6 +12,9 @@
 // This data has to be non-const as we allow writing to blocks of data. Please don't attempt to overwrite the test data.
 extern unsigned char testData[16];
 
+// The same Raw Network Ordered Bytes as above, but truly read only.
+extern const unsigned char constTestData[16];
+
 extern const unsigned short uShortTestVal1;
 extern const unsigned short uShortTestVal2;
 extern const signed short sShortTestVal;
@@ -0,0 +1,166 @@
+/**
+* @file asyncFileTest.cpp
+* @brief Test Harness to Verify AsyncFileSink and AsyncFileSource Against Local Temporary Files
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "AsyncFileSink.h"
+#include "AsyncFileSource.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    std::string makeTempPath()
+    {
+        const char * pTmpDir = getenv( "TMPDIR" );
+        std::string path = std::string( pTmpDir ? pTmpDir : "/tmp" ) + "/asyncFileTestXXXXXX";
+        const int fd = mkstemp( &path[0] );
+        if ( 0 <= fd ) close( fd );
+        return path;
+    }
+
+    // Write blocks of sequence numbers, some full and some partial, recording what is expected in the file.
+    bool writeFile( const std::string & path, bool directIo, AsyncIoBackend backend,
+                    std::vector< unsigned char > & expected )
+    {
+        AsyncFileSink sink( path.c_str(), 8192, 3, directIo, backend );
+        std::cout << "  sink io_uring " << sink.usingIoUring() << ", O_DIRECT " << sink.usingDirectIo() << std::endl;
+
+        uint32_t sequence = 0;
+        for ( unsigned i = 0; 200 != i; ++i )
+        {
+            ByteStreambuf & block = sink.acquire();
+            const size_t numValues = 0 == i % 3 ? 250 + i : 8192 / sizeof( uint32_t );
+            for ( size_t j = 0; numValues != j; ++j, ++sequence )
+            {
+                if ( sizeof( sequence ) != typeToNet( sequence, block ) ) return false;
+                for ( unsigned k = 0; sizeof( sequence ) != k; ++k )
+                    expected.push_back( (unsigned char)( sequence >> ( 24 - 8 * k ) ) );
+            }
+            sink.submit( block );
+        }
+
+        // A block with nothing put writes nothing.
+        sink.submit( sink.acquire() );
+
+        sink.flush();
+        return expected.size() == sink.bytesSubmitted();
+    }
+
+    bool readFile( const std::string & path, size_t blockSize, bool directIo, AsyncIoBackend backend,
+                   const std::vector< unsigned char > & expected )
+    {
+        AsyncFileSource source( path.c_str(), blockSize, 3, directIo, backend );
+        std::vector< unsigned char > actual;
+        while ( ByteStreambuf * pBlock = source.next() )
+        {
+            while ( 0 < pBlock->in_avail() )
+                actual.push_back( (unsigned char)pBlock->sbumpc() );
+        }
+
+        // End of file persists.
+        return nullptr == source.next() && expected == actual;
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+    const std::string path = makeTempPath();
+
+    do {
+        // TEST EACH BACKEND, WITH AND WITHOUT DIRECT I/O
+        const AsyncIoBackend backends[] = { AsyncIoBackend::automatic, AsyncIoBackend::threadPool };
+        bool failed = false;
+        for ( auto backend : backends )
+        {
+            for ( int directIo = 0; 2 != directIo && !failed; ++directIo )
+            {
+                std::cout << "Backend " << ( AsyncIoBackend::automatic == backend ? "automatic" : "threadPool" )
+                          << ", direct I/O requested " << directIo << std::endl;
+
+                std::vector< unsigned char > expected;
+                if ( !writeFile( path, 0 != directIo, backend, expected ) )
+                {
+                    std::cout << "AsyncFileSink write FAILED!" << std::endl;
+                    retCode = 1;
+                    failed = true;
+                    break;
+                }
+
+                struct stat st;
+                if ( 0 != stat( path.c_str(), &st ) || expected.size() != size_t( st.st_size ) )
+                {
+                    std::cout << "Expected file of " << expected.size() << " bytes!" << std::endl;
+                    retCode = 2;
+                    failed = true;
+                    break;
+                }
+
+                // Aligned blocks, and blocks which are not, which never use O_DIRECT.
+                if ( !readFile( path, 4096, 0 != directIo, backend, expected ) ||
+                     !readFile( path, 5000, 0 != directIo, backend, expected ) )
+                {
+                    std::cout << "AsyncFileSource read FAILED!" << std::endl;
+                    retCode = 3;
+                    failed = true;
+                    break;
+                }
+            }
+        }
+        if ( failed ) break;
+
+        // TEST AN EMPTY FILE
+        {
+            AsyncFileSink sink( path.c_str() );
+        }
+        {
+            AsyncFileSource source( path.c_str() );
+            if ( nullptr != source.next() )
+            {
+                std::cout << "Expected no blocks from an empty file!" << std::endl;
+                retCode = 4;
+                break;
+            }
+        }
+
+        // TEST A BLOCK FROM ELSEWHERE IS REFUSED
+        try {
+            AsyncFileSink sink( path.c_str() );
+            unsigned char buffer[16];
+            ByteStreambuf foreign( buffer, sizeof( buffer ), std::ios_base::out );
+            sink.submit( foreign );
+            std::cout << "Expected submit of a foreign block to throw!" << std::endl;
+            retCode = 5;
+            break;
+        }
+        catch ( const std::invalid_argument & ) {}
+
+        // TEST A MISSING FILE IS REPORTED
+        unlink( path.c_str() );
+        try {
+            AsyncFileSource source( path.c_str() );
+            std::cout << "Expected opening a missing file to throw!" << std::endl;
+            retCode = 6;
+            break;
+        }
+        catch ( const std::system_error & ) {}
+
+    } while( false );
+
+    unlink( path.c_str() );
+    return retCode;
+}
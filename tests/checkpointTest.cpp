@@ -0,0 +1,108 @@
+/**
+* @file checkpointTest.cpp
+* @brief Test Harness to Verify ByteStreamCheckpoint Rollback, Commit and Nesting
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "ByteStreamCheckpoint.h"
+
+#include "TestData.h"
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        ByteStreambuf byteStreambuf{ testData, sizeof( testData ), std::ios::in };
+        InputByteStream inputByteStream{ &byteStreambuf };
+
+        // TEST ROLLBACK UPON DESTRUCTION RESTORES POSITION AND CLEARS FAILURE
+        netToType< unsigned short >( inputByteStream );
+        {
+            ByteStreamCheckpoint checkpoint( byteStreambuf, &inputByteStream );
+            netToType< unsigned long >( inputByteStream );
+            netToType< unsigned long >( inputByteStream );
+            if ( inputByteStream.good() )
+            {
+                std::cout << "Expected reading past the end to fail the stream!" << std::endl;
+                retCode = 1;
+                break;
+            }
+        }
+        if ( !inputByteStream.good() || 2 != inputByteStream.tellg() ||
+             uShortTestVal2 != netToType< unsigned short >( inputByteStream ) )
+        {
+            std::cout << "Expected rollback to restore the stream at offset 2!" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // TEST COMMIT KEEPS WHAT WAS READ
+        {
+            ByteStreamCheckpoint checkpoint( byteStreambuf, &inputByteStream );
+            netToType< unsigned int >( inputByteStream );
+            checkpoint.commit();
+        }
+        if ( 8 != inputByteStream.tellg() ) { retCode = 3; break; }
+
+        // TEST NESTING, AN OUTER ROLLBACK UNDOING A COMMITTED INNER CHECKPOINT
+        inputByteStream.seekg( 0 );
+        {
+            ByteStreamCheckpoint outer( byteStreambuf, &inputByteStream );
+            netToType< unsigned short >( inputByteStream );
+            {
+                ByteStreamCheckpoint inner( byteStreambuf, &inputByteStream );
+                netToType< unsigned int >( inputByteStream );
+                inner.rollback();
+                if ( 2 != inputByteStream.tellg() ) { retCode = 4; break; }
+
+                // The inner checkpoint remains in effect after an explicit rollback.
+                netToType< unsigned short >( inputByteStream );
+                inner.commit();
+            }
+            if ( 4 != inputByteStream.tellg() ) { retCode = 5; break; }
+        }
+        if ( 0 != inputByteStream.tellg() ) { retCode = 6; break; }
+
+        // TEST THE PUT POSITION IS RESTORED TOO
+        unsigned char outputBuffer[8];
+        ByteStreambuf outByteStreambuf{ outputBuffer, sizeof( outputBuffer ), std::ios::out };
+        typeToNet( uShortTestVal1, outByteStreambuf );
+        {
+            ByteStreamCheckpoint checkpoint( outByteStreambuf );
+            typeToNet( uIntTestVal, outByteStreambuf );
+        }
+        if ( 2 != outByteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+        {
+            std::cout << "Expected rollback to restore the put position to 2!" << std::endl;
+            retCode = 7;
+            break;
+        }
+
+        // TEST ROLLBACK UPON DESTRUCTION RESTORES A STATE THE EXCEPTION MASK WOULD THROW UPON, WITHOUT THROWING
+        inputByteStream.seekg( 0, std::ios_base::end );
+        inputByteStream.get();
+        {
+            ByteStreamCheckpoint checkpoint( byteStreambuf, &inputByteStream );
+            inputByteStream.clear();
+            inputByteStream.seekg( 0 );
+            inputByteStream.exceptions( std::ios_base::eofbit );
+        }
+        const bool restored = inputByteStream.eof() && std::ios_base::eofbit == inputByteStream.exceptions();
+        inputByteStream.exceptions( std::ios_base::goodbit );
+        if ( !restored )
+        {
+            std::cout << "Expected rollback upon destruction to restore eof without throwing!" << std::endl;
+            retCode = 8;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,153 @@
+/**
+* @file coalescingTest.cpp
+* @brief Test Harness to Verify MessageCoalescer and DatagramSplitter
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "MessageCoalescer.h"
+#include "DatagramSplitter.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    using Datagrams = std::vector< std::vector< unsigned char > >;
+
+    MessageCoalescer::FlushHandler collector( Datagrams & datagrams )
+    {
+        return [ &datagrams ]( const unsigned char * pDatagram, size_t len )
+        {
+            datagrams.emplace_back( pDatagram, pDatagram + len );
+        };
+    }
+
+    // Each message is a sequence number followed by a number of filler bytes depending upon it.
+    void commitMessage( MessageCoalescer & coalescer, uint32_t sequence )
+    {
+        ByteStreambuf * pMessage = coalescer.reserve( 64 );
+        typeToNet( sequence, *pMessage );
+        for ( uint32_t i = 0; 16 + sequence % 40 != i; ++i )
+            typeToNet( uint8_t( sequence ), *pMessage );
+        coalescer.commit();
+    }
+
+    // Returns the number of messages verified, or -1 upon a mismatch.
+    int verifyDatagram( const std::vector< unsigned char > & datagram, uint32_t & sequence )
+    {
+        int count = 0;
+        DatagramSplitter splitter( datagram.data(), datagram.size() );
+        while ( InputByteStream * pMessage = splitter.next() )
+        {
+            uint32_t messageSequence = 0;
+            if ( sizeof( messageSequence ) != netToType( *pMessage, messageSequence ) || sequence != messageSequence )
+                return -1;
+            for ( uint32_t i = 0; 16 + sequence % 40 != i; ++i )
+            {
+                uint8_t byte = 0;
+                if ( 1 != netToType( *pMessage, byte ) || uint8_t( sequence ) != byte ) return -1;
+            }
+
+            // The stream is confined to its message.
+            pMessage->get();
+            if ( !pMessage->eof() ) return -1;
+            ++sequence;
+            ++count;
+        }
+        return splitter.malformed() ? -1 : count;
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // TEST FLUSHING WHEN FULL
+        Datagrams datagrams;
+        MessageCoalescer coalescer( collector( datagrams ), 512 );
+        for ( uint32_t sequence = 0; 1000 != sequence; ++sequence )
+            commitMessage( coalescer, sequence );
+        coalescer.flush();
+        if ( 0 != coalescer.pendingMessages() || 0 != coalescer.pendingBytes() ) { retCode = 1; break; }
+
+        uint32_t sequence = 0;
+        bool failed = false;
+        for ( const auto & datagram : datagrams )
+        {
+            if ( 512 < datagram.size() || 0 > verifyDatagram( datagram, sequence ) )
+            {
+                std::cout << "Coalesced datagram FAILED verification at sequence " << sequence << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if ( failed ) { retCode = 2; break; }
+        if ( 1000 != sequence || 100 < datagrams.size() )
+        {
+            std::cout << "Expected 1000 messages in no more than 100 datagrams, got " << sequence << " in "
+                      << datagrams.size() << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // TEST THE SIZE THRESHOLD
+        datagrams.clear();
+        MessageCoalescer thresholdCoalescer( collector( datagrams ), 512, 100 );
+        const unsigned char message[40] = {};
+        thresholdCoalescer.append( message, sizeof( message ) );
+        thresholdCoalescer.append( message, sizeof( message ) );
+        if ( !datagrams.empty() || 84 != thresholdCoalescer.pendingBytes() ) { retCode = 4; break; }
+        thresholdCoalescer.append( message, sizeof( message ) );
+        if ( 1 != datagrams.size() || 126 != datagrams[0].size() || 0 != thresholdCoalescer.pendingMessages() )
+        {
+            std::cout << "Expected the commit reaching the threshold to flush!" << std::endl;
+            retCode = 5;
+            break;
+        }
+
+        // TEST THE MAXIMUM DELAY
+        datagrams.clear();
+        MessageCoalescer delayCoalescer( collector( datagrams ), 512, 0, std::chrono::microseconds( 1000 ) );
+        delayCoalescer.append( message, 0 );
+        delayCoalescer.poll();
+        if ( !datagrams.empty() ) { retCode = 6; break; }
+        std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+        delayCoalescer.poll();
+        if ( 1 != datagrams.size() || 2 != datagrams[0].size() )
+        {
+            std::cout << "Expected poll after the maximum delay to flush!" << std::endl;
+            retCode = 7;
+            break;
+        }
+
+        // TEST MESSAGES TOO LARGE ARE REFUSED
+        if ( nullptr != delayCoalescer.reserve( 511 ) || delayCoalescer.append( message, 511 ) ||
+             nullptr == delayCoalescer.reserve( 510 ) )
+        {
+            std::cout << "Expected only messages fitting a datagram to be reserved!" << std::endl;
+            retCode = 8;
+            break;
+        }
+
+        // TEST MALFORMED DATAGRAMS ARE DETECTED
+        const unsigned char truncated[] = { 0x00, 0x02, 0xAA, 0xBB, 0x00, 0x05, 0xCC };
+        DatagramSplitter splitter( truncated, sizeof( truncated ) );
+        if ( !splitter.next() || 2 != splitter.streambuf().in_avail() || splitter.next() || !splitter.malformed() )
+        {
+            std::cout << "Expected a truncated message to be detected as malformed!" << std::endl;
+            retCode = 9;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,218 @@
+/**
+* @file compressionTest.cpp
+* @brief Test Harness to Verify LzBlockCodec and the Compressing and Decompressing Byte Stream Buffers
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "LzBlockCodec.h"
+#include "CompressingByteStreambuf.h"
+#include "DecompressingByteStreambuf.h"
+
+#include <stdexcept>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    bool roundTrip( const std::vector< unsigned char > & input )
+    {
+        std::vector< unsigned char > compressed( LzBlockCodec::compressBound( input.size() ) );
+        const auto compressedLen = LzBlockCodec::compress( input.data(), input.size(),
+                                                           compressed.data(), compressed.size() );
+        if ( 0 == compressedLen ) return false;
+
+        std::vector< unsigned char > output( input.size() );
+        const auto outputLen = LzBlockCodec::decompress( compressed.data(), compressedLen,
+                                                         output.data(), output.size() );
+        return input.size() == outputLen && input == output;
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // TEST CODEC ROUND TRIPS
+        std::vector< unsigned char > repetitive( 100000 );
+        for ( size_t i = 0; repetitive.size() != i; ++i )
+            repetitive[i] = (unsigned char)( ( i / 7 ) % 13 );
+
+        std::vector< unsigned char > random( 100000 );
+        uint32_t seed = 12345;
+        for ( auto & byte : random )
+        {
+            seed = seed * 1103515245 + 12345;
+            byte = (unsigned char)( seed >> 16 );
+        }
+
+        // Long runs exercise overlapping matches and length extensions.
+        std::vector< unsigned char > runs( 70000, 0xAA );
+
+        if ( !roundTrip( repetitive ) || !roundTrip( random ) || !roundTrip( runs ) ||
+             !roundTrip( std::vector< unsigned char >( 5, 1 ) ) || !roundTrip( std::vector< unsigned char >() ) )
+        {
+            std::cout << "LzBlockCodec round trip FAILED!" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Repetitive data should compress well.
+        std::vector< unsigned char > compressed( LzBlockCodec::compressBound( repetitive.size() ) );
+        const auto compressedLen = LzBlockCodec::compress( repetitive.data(), repetitive.size(),
+                                                           compressed.data(), compressed.size() );
+        if ( compressedLen > repetitive.size() / 10 )
+        {
+            std::cout << "Expected repetitive data to compress by 10x. Compressed to " << compressedLen
+                      << " bytes" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Decompressing into too small a buffer, or truncated input, must fail safely.
+        std::vector< unsigned char > output( repetitive.size() - 1 );
+        if ( LzBlockCodec::errorSize != LzBlockCodec::decompress( compressed.data(), compressedLen,
+                                                                  output.data(), output.size() ) ||
+             LzBlockCodec::errorSize != LzBlockCodec::decompress( compressed.data(), compressedLen / 2,
+                                                                  output.data(), output.size() ) )
+        {
+            std::cout << "Expected decompression of truncated input or into too small a buffer to fail!"
+                      << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // TEST STREAM BUFFER ROUND TRIP
+        // A small block size forces values to straddle block boundaries. Include a run of random
+        // bytes so that some blocks are stored raw.
+        std::vector< unsigned char > archive( 1 << 20 );
+        ByteStreambuf archiveStreambuf{ archive.data(), std::streamsize( archive.size() ) };
+        OutputByteStream archiveOutStream{ &archiveStreambuf };
+        constexpr uint32_t numRecords = 5000;
+        uint64_t bytesIn = 0;
+        uint64_t bytesOut = 0;
+        {
+            CompressingByteStreambuf compressingByteStreambuf{ archiveOutStream, 250 };
+            OutputByteStream outputByteStream{ &compressingByteStreambuf };
+            for ( uint32_t i = 0; numRecords != i; ++i )
+            {
+                typeToNet( uint16_t( 7 ), outputByteStream );
+                typeToNet( i, outputByteStream );
+                typeToNet( double( i ) * 0.25, outputByteStream );
+            }
+            outputByteStream.write( random.data(), 1000 );
+            outputByteStream.flush();
+            if ( !outputByteStream )
+            {
+                std::cout << "Compressing output stream NOT OKAY after writing!" << std::endl;
+                retCode = 4;
+                break;
+            }
+            bytesIn = compressingByteStreambuf.bytesIn();
+            bytesOut = compressingByteStreambuf.bytesOut();
+        }
+        if ( numRecords * 14 + 1000 != bytesIn || bytesOut != uint64_t( archiveOutStream.tellp() ) )
+        {
+            std::cout << "Unexpected byte counts. In " << bytesIn << ", out " << bytesOut << std::endl;
+            retCode = 5;
+            break;
+        }
+
+        ByteStreambuf archiveInStreambuf{ archive.data(), std::streamsize( bytesOut ), std::ios::in };
+        InputByteStream archiveInStream{ &archiveInStreambuf };
+        DecompressingByteStreambuf decompressingByteStreambuf{ archiveInStream, 250 };
+        InputByteStream inputByteStream{ &decompressingByteStreambuf };
+        for ( uint32_t i = 0; numRecords != i; ++i )
+        {
+            const auto type = netToType< uint16_t >( inputByteStream );
+            const auto sequence = netToType< uint32_t >( inputByteStream );
+            const auto value = netToType< double >( inputByteStream );
+            if ( !inputByteStream || 7 != type || i != sequence || double( i ) * 0.25 != value )
+            {
+                std::cout << "Decompressed record " << i << " FAILED! Got type " << type << ", sequence "
+                          << sequence << ", value " << value << std::endl;
+                retCode = 6;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        std::vector< unsigned char > randomOut( 1000 );
+        inputByteStream.read( randomOut.data(), std::streamsize( randomOut.size() ) );
+        if ( !inputByteStream || 0 != memcmp( randomOut.data(), random.data(), randomOut.size() ) )
+        {
+            std::cout << "Decompressed raw block FAILED!" << std::endl;
+            retCode = 7;
+            break;
+        }
+
+        // The end of the archive should be a clean EOF.
+        inputByteStream.get();
+        if ( inputByteStream || decompressingByteStreambuf.corrupt() )
+        {
+            std::cout << "Expected a clean EOF at the end of the archive!" << std::endl;
+            retCode = 8;
+            break;
+        }
+
+        // A frame claiming a block larger than the maximum must be treated as corrupt.
+        archive[3] = 0xFF;
+        archiveInStreambuf.pubseekpos( 0, std::ios_base::in );
+        archiveInStream.clear();
+        DecompressingByteStreambuf corruptByteStreambuf{ archiveInStream, 250 };
+        InputByteStream corruptStream{ &corruptByteStreambuf };
+        corruptStream.get();
+        if ( corruptStream || !corruptByteStreambuf.corrupt() )
+        {
+            std::cout << "Expected a corrupt frame to be detected!" << std::endl;
+            retCode = 9;
+            break;
+        }
+
+        // A final block which cannot be written on destruction must not throw out of the destructor, even with
+        // exceptions enabled downstream. Syncing beforehand reports the failure.
+        {
+            unsigned char tiny[ 4 ];
+            ByteStreambuf tinyStreambuf{ tiny, sizeof( tiny ), std::ios_base::out };
+            OutputByteStream tinyStream{ &tinyStreambuf };
+            tinyStream.exceptions( std::ios_base::badbit | std::ios_base::failbit );
+            bool syncThrew = false;
+            {
+                CompressingByteStreambuf failingByteStreambuf{ tinyStream, 64 };
+                const unsigned char bytes[ 16 ]{};
+                failingByteStreambuf.sputn( bytes, sizeof( bytes ) );
+                try { failingByteStreambuf.pubsync(); }
+                catch ( const std::ios_base::failure & ) { syncThrew = true; }
+                failingByteStreambuf.sputn( bytes, sizeof( bytes ) );
+            }
+            if ( !syncThrew )
+            {
+                std::cout << "Expected syncing onto a failing downstream to throw!" << std::endl;
+                retCode = 10;
+                break;
+            }
+        }
+
+        // A block size beyond what a frame header can describe is rejected.
+        ByteStreambuf nowhereStreambuf{ nullptr, 0, std::ios_base::out };
+        OutputByteStream nowhereStream{ &nowhereStreambuf };
+        bool blockSizeThrew = false;
+        try { CompressingByteStreambuf oversized{ nowhereStream, size_t( CompressedFrameFormat::storedRawFlag ) }; }
+        catch ( const std::invalid_argument & ) { blockSizeThrew = true; }
+        if ( !blockSizeThrew )
+        {
+            std::cout << "Expected a block size of 2^31 to throw!" << std::endl;
+            retCode = 11;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,120 @@
+/**
+* @file constByteStreambufTest.cpp
+* @brief Test Harness to Verify Input Serialization from Read Only Memory with ConstByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+
+#include "TestData.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    // Map a page, copy the test data into it and then make it read only. Any attempt to write
+    // through the stream buffer will result in a segmentation fault.
+    const auto pageSize = size_t( sysconf( _SC_PAGESIZE ) );
+    void * pMapping = mmap( nullptr, pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( MAP_FAILED == pMapping )
+    {
+        std::cout << "Failed to map memory for test!" << std::endl;
+        return 1;
+    }
+    memcpy( pMapping, constTestData, sizeof( constTestData ) );
+    mprotect( pMapping, pageSize, PROT_READ );
+    const auto pReadOnly = static_cast< const unsigned char * >( pMapping );
+
+    do {
+        // Construct ConstByteStreambuf with a truly const data block.
+        ConstByteStreambuf constByteStreambuf{ constTestData, sizeof( constTestData ) };
+        InputByteStream inputByteStream{ &constByteStreambuf };
+
+        // How many bytes are in the stream buffer
+        const auto availBytesForReading = inputByteStream.rdbuf()->in_avail();
+        if ( sizeof( constTestData ) != availBytesForReading )
+        {
+            std::cout << "Expected Input Stream read buffer would indicate that " << sizeof( constTestData )
+                      << " bytes are available for reading. Found "  << availBytesForReading
+                      << " are available" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // TEST UNSIGNED INT via the return value overload
+        const auto uIntVal = netToType<unsigned int>( inputByteStream );
+        if ( uIntVal != uIntTestVal )
+        {
+            std::cout << "netToType<unsigned int> FAILED!  Expected 0x" << std::hex << uIntTestVal
+                      << ", got 0x" << std::hex << uIntVal
+                      << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // TEST DOUBLE via the output argument overload
+        inputByteStream.seekg( 0 );    // Rewind
+        double doubleVal;
+        const auto bytesRead = netToType( inputByteStream, doubleVal );
+        if ( sizeof( doubleVal ) != bytesRead || doubleVal != doubleTestVal )
+        {
+            std::cout << "netToType<double> FAILED!  Expected " << doubleTestVal
+                      << ", got " << doubleVal << " with " << bytesRead << " bytes read"
+                      << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // Now from a PROT_READ mapping.
+        ConstByteStreambuf mappedByteStreambuf{ pReadOnly, std::streamsize( sizeof( constTestData ) ) };
+        InputByteStream mappedByteStream{ &mappedByteStreambuf };
+        const auto uLongVal = netToType<unsigned long>( mappedByteStream );
+        if ( uLongVal != uLongTestVal )
+        {
+            std::cout << "netToType<unsigned long> FAILED!  Expected 0x" << std::hex << uLongTestVal
+                      << ", got 0x" << std::hex << uLongVal
+                      << std::endl;
+            retCode = 5;
+            break;
+        }
+
+        // Putting back a different byte than was read must fail rather than write to read only memory.
+        mappedByteStream.putback( 0xFF );
+        if ( mappedByteStream )
+        {
+            std::cout << "Expected putback of a different byte to fail on a read only buffer!" << std::endl;
+            retCode = 6;
+            break;
+        }
+        mappedByteStream.clear();
+
+        // There is no put area, so putting must fail without writing.
+        if ( std::char_traits< unsigned char >::eof() != mappedByteStreambuf.sputc( 0xFF ) )
+        {
+            std::cout << "Expected sputc to fail on a read only buffer!" << std::endl;
+            retCode = 7;
+            break;
+        }
+
+        // Verify the mapping is unchanged.
+        if ( 0 != memcmp( pReadOnly, constTestData, sizeof( constTestData ) ) )
+        {
+            std::cout << "Read only memory was modified!" << std::endl;
+            retCode = 8;
+            break;
+        }
+
+    } while( false );
+
+    munmap( pMapping, pageSize );
+
+    return retCode;
+}
@@ -0,0 +1,113 @@
+/**
+* @file countingByteStreambufTest.cpp
+* @brief Test Harness to Verify a Counting ByteStreambuf Sizes Serialization Exactly
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "CountingByteStreambuf.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    // A message with a length prefix backpatched once the body has been written.
+    void serialize( const std::string & name, size_t numValues, OutputByteStream & stream )
+    {
+        const auto lengthPos = stream.tellp();
+        typeToNet( uint32_t( 0 ), stream );
+        typeToNet( uint16_t( name.size() ), stream );
+        stream.write( reinterpret_cast< const unsigned char * >( name.data() ), std::streamsize( name.size() ) );
+        for ( size_t i = 0; numValues != i; ++i ) typeToNet( double( i ), stream );
+        stream.put( 0x7E );
+
+        const auto endPos = stream.tellp();
+        stream.seekp( lengthPos );
+        typeToNet( uint32_t( endPos - lengthPos - 4 ), stream );
+        stream.seekp( endPos );
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // TEST THE COUNT MATCHES WHAT IS ACTUALLY WRITTEN, INCLUDING BACKPATCHING
+        const std::string name( 150, 'x' );
+        CountingByteStreambuf countingByteStreambuf;
+        OutputByteStream counter( &countingByteStreambuf );
+        serialize( name, 37, counter );
+        serialize( "short", 0, counter );
+
+        std::vector< unsigned char > buffer( countingByteStreambuf.size() );
+        ByteStreambuf byteStreambuf{ buffer.data(), std::streamsize( buffer.size() ), std::ios_base::out };
+        OutputByteStream writer( &byteStreambuf );
+        serialize( name, 37, writer );
+        serialize( "short", 0, writer );
+
+        if ( !counter || !writer || 4 + 2 + 150 + 37 * 8 + 1 + 4 + 2 + 5 + 1 != countingByteStreambuf.size() ||
+             std::streamoff( countingByteStreambuf.size() ) != writer.tellp() )
+        {
+            std::cout << "Expected a count of " << writer.tellp() << ", got " << countingByteStreambuf.size()
+                      << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // TEST SIZE IS THE FURTHEST POSITION REACHED, AND SEEKING IS BOUNDED BY IT
+        const size_t size = countingByteStreambuf.size();
+        counter.seekp( 10 );
+        typeToNet( uint64_t( 0 ), counter );
+        if ( 18 != counter.tellp() || size != countingByteStreambuf.size() )
+        {
+            std::cout << "Expected the size to remain " << size << " after backpatching!" << std::endl;
+            retCode = 2;
+            break;
+        }
+        counter.seekp( std::streamoff( size + 1 ) );
+        if ( counter.good() || 18 != countingByteStreambuf.position() )
+        {
+            std::cout << "Expected seeking beyond the size to fail!" << std::endl;
+            retCode = 3;
+            break;
+        }
+        counter.clear();
+        counter.seekp( -2, std::ios_base::end );
+        if ( std::streamoff( size - 2 ) != counter.tellp() )
+        {
+            std::cout << "Expected seeking from the end to be relative to the size!" << std::endl;
+            retCode = 4;
+            break;
+        }
+        typeToNet( uint32_t( 0 ), counter );
+        if ( size + 2 != countingByteStreambuf.size() )
+        {
+            std::cout << "Expected writing past the size to grow it!" << std::endl;
+            retCode = 5;
+            break;
+        }
+
+        // TEST DIRECT COUNTING AND RESET
+        countingByteStreambuf.reset();
+        typeToNet( uint16_t( 1 ), countingByteStreambuf );
+        typeToNet( 1.0, countingByteStreambuf );
+        for ( int i = 0; 1000 != i; ++i ) counter.put( 0 );
+        if ( 1010 != countingByteStreambuf.size() || 1010 != counter.tellp() )
+        {
+            std::cout << "Expected direct counting after reset to total 1010, got " << countingByteStreambuf.size()
+                      << std::endl;
+            retCode = 6;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
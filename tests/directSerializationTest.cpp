@@ -0,0 +1,111 @@
+/**
+* @file directSerializationTest.cpp
+* @brief Test Harness to Verify Serialization Directly Upon a ByteStreambuf without a Stream
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+
+#include "TestData.h"
+
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // Read from a read only ByteStreambuf, bypassing the stream.
+        ConstByteStreambuf constByteStreambuf{ constTestData, sizeof( constTestData ) };
+
+        const auto uShortVal1 = netToType<unsigned short>( constByteStreambuf );
+        const auto uShortVal2 = netToType<unsigned short>( constByteStreambuf );
+        if ( uShortVal1 != uShortTestVal1 || uShortVal2 != uShortTestVal2 )
+        {
+            std::cout << "netToType<unsigned short> FAILED!  Expected 0x" << std::hex << uShortTestVal1
+                      << " and 0x" << uShortTestVal2 << ", got 0x" << uShortVal1 << " and 0x" << uShortVal2
+                      << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // The get position should have advanced.
+        auto expectedBytesLeft = sizeof( constTestData ) - sizeof( unsigned short ) * 2;
+        if ( constByteStreambuf.in_avail() != (long)expectedBytesLeft )
+        {
+            std::cout << "Expected stream buffer would have " << expectedBytesLeft
+                      << " remaining for input and " << constByteStreambuf.in_avail() << " are remaining"
+                      << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Each type, rewinding between them.
+        constByteStreambuf.pubseekpos( 0, std::ios_base::in );
+        if ( netToType<signed int>( constByteStreambuf ) != sIntTestVal ) { retCode = 3; break; }
+        constByteStreambuf.pubseekpos( 0, std::ios_base::in );
+        if ( netToType<signed long>( constByteStreambuf ) != sLongTestVal ) { retCode = 4; break; }
+        constByteStreambuf.pubseekpos( 0, std::ios_base::in );
+        if ( netToType<float>( constByteStreambuf ) != floatTestVal ) { retCode = 5; break; }
+        constByteStreambuf.pubseekpos( 0, std::ios_base::in );
+        double doubleVal = 0.0;
+        if ( sizeof( doubleVal ) != netToType( constByteStreambuf, doubleVal ) || doubleVal != doubleTestVal )
+        {
+            std::cout << "netToType<double> FAILED!  Expected " << doubleTestVal << ", got " << doubleVal
+                      << std::endl;
+            retCode = 6;
+            break;
+        }
+
+        // There are 8 bytes left. Reading 8 more succeeds, after which a read is all or nothing.
+        unsigned long uLongVal = 0;
+        if ( sizeof( uLongVal ) != netToType( constByteStreambuf, uLongVal ) ) { retCode = 7; break; }
+        unsigned short shortVal = 0x1234;
+        if ( 0 != netToType( constByteStreambuf, shortVal ) || 0x1234 != shortVal )
+        {
+            std::cout << "Expected netToType at end of buffer to return 0 bytes and leave value unchanged!"
+                      << std::endl;
+            retCode = 8;
+            break;
+        }
+
+        // Now write into a buffer, bypassing the stream.
+        unsigned char outputBuffer[6];
+        ByteStreambuf outByteStreambuf{ outputBuffer, sizeof( outputBuffer ), std::ios::out };
+        auto bytesWritten = typeToNet( uIntTestVal, outByteStreambuf );
+        if ( sizeof( uIntTestVal ) != bytesWritten || 0 != memcmp( outputBuffer, testData, bytesWritten ) )
+        {
+            std::cout << "typeToNet<unsigned int> FAILED! Wrote " << bytesWritten << " bytes" << std::endl;
+            retCode = 9;
+            break;
+        }
+
+        // There are 2 bytes of room left. An unsigned int will not fit and nothing should be written.
+        bytesWritten = typeToNet( uIntTestVal, outByteStreambuf );
+        if ( 0 != bytesWritten || sizeof( uIntTestVal ) != outByteStreambuf.pubseekoff( 0, std::ios_base::cur,
+                                                                                        std::ios_base::out ) )
+        {
+            std::cout << "Expected typeToNet past the end of buffer to write nothing!" << std::endl;
+            retCode = 10;
+            break;
+        }
+
+        // The direct and stream paths must interoperate. Write via the stream after the direct write.
+        OutputByteStream outputByteStream{ &outByteStreambuf };
+        bytesWritten = typeToNet( uShortTestVal1, outputByteStream );
+        if ( sizeof( uShortTestVal1 ) != bytesWritten || 0x42 != outputBuffer[4] || 0x41 != outputBuffer[5] )
+        {
+            std::cout << "Expected stream write to follow direct write!" << std::endl;
+            retCode = 11;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,216 @@
+/**
+* @file incrementalDecoderTest.cpp
+* @brief Test Harness to Verify Messages Decode Identically However They Are Segmented
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "IncrementalDecoder.h"
+
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    struct Message
+    {
+        uint8_t type{};
+        uint16_t flags{};
+        int32_t id{};
+        double value{};
+        uint32_t count{};
+        std::vector< int16_t > samples;
+        uint8_t nameLength{};
+        std::vector< unsigned char > name;
+        unsigned char trailer[ 4 ]{};
+        float gain{};
+
+        bool operator==( const Message & other ) const
+        {
+            return type == other.type && flags == other.flags && id == other.id && value == other.value &&
+                   count == other.count && samples == other.samples && nameLength == other.nameLength &&
+                   name == other.name && 0 == std::memcmp( trailer, other.trailer, sizeof( trailer ) ) &&
+                   gain == other.gain;
+        }
+    };
+
+    void describe( Message & message, IncrementalDecoder & decoder )
+    {
+        decoder.field( message.type ).field( message.flags ).field( message.id ).field( message.value )
+               .field( message.count ).array( message.samples, message.count, 1000 )
+               .field( message.nameLength ).bytes( message.name, message.nameLength, 255 )
+               .bytes( message.trailer, sizeof( message.trailer ) ).skip( 3 ).field( message.gain );
+    }
+
+    void serialize( const Message & message, ByteStreambuf & out )
+    {
+        typeToNet( message.type, out );
+        typeToNet( message.flags, out );
+        typeToNet( message.id, out );
+        typeToNet( message.value, out );
+        typeToNet( message.count, out );
+        for ( auto sample : message.samples ) typeToNet( sample, out );
+        typeToNet( message.nameLength, out );
+        std::memcpy( out.claimPutBytes( message.name.size() ), message.name.data(), message.name.size() );
+        std::memcpy( out.claimPutBytes( sizeof( message.trailer ) ), message.trailer, sizeof( message.trailer ) );
+        std::memset( out.claimPutBytes( 3 ), 0xEE, 3 );
+        typeToNet( message.gain, out );
+    }
+
+    Message makeMessage( uint32_t count, uint8_t nameLength )
+    {
+        Message message;
+        message.type = 7;
+        message.flags = 0xA55A;
+        message.id = -123456;
+        message.value = 3.14159265358979;
+        message.count = count;
+        for ( uint32_t i = 0; count != i; ++i ) message.samples.push_back( int16_t( i * 977 - 20000 ) );
+        message.nameLength = nameLength;
+        for ( uint8_t i = 0; nameLength != i; ++i ) message.name.push_back( uint8_t( 'a' + i % 26 ) );
+        std::memcpy( message.trailer, "\xDE\xAD\xBE\xEF", 4 );
+        message.gain = -0.5f;
+        return message;
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        std::vector< unsigned char > wire( 4096 );
+        ByteStreambuf out{ wire.data(), std::streamsize( wire.size() ), std::ios_base::out };
+        const Message expected = makeMessage( 53, 11 );
+        serialize( expected, out );
+        const size_t len = size_t( out.position().pPut - wire.data() );
+
+        // TEST EVERY SEGMENT SIZE, FROM ONE BYTE AT A TIME TO THE WHOLE MESSAGE AT ONCE
+        for ( size_t segmentSize = 1; len >= segmentSize && 0 == retCode; ++segmentSize )
+        {
+            Message message;
+            IncrementalDecoder decoder;
+            describe( message, decoder );
+
+            IncrementalDecoder::Status status = IncrementalDecoder::Status::incomplete;
+            for ( size_t offset = 0; len > offset; offset += segmentSize )
+            {
+                ConstByteStreambuf segment{ wire.data() + offset, std::streamsize( std::min( segmentSize, len - offset ) ) };
+                status = decoder.decode( segment );
+                if ( segment.getAreaEnd() != segment.position().pGet ) break;
+                const bool last = len <= offset + segmentSize;
+                if ( ( IncrementalDecoder::Status::complete == status ) != last ) break;
+            }
+            if ( IncrementalDecoder::Status::complete != status || len != decoder.consumed() || !( expected == message ) )
+            {
+                std::cout << "Decoding in segments of " << segmentSize << " bytes did not match the message" << std::endl;
+                retCode = 1;
+            }
+        }
+        if ( 0 != retCode ) break;
+
+        // TEST EVERY SPLIT OF THE MESSAGE INTO TWO SEGMENTS
+        for ( size_t split = 0; len >= split && 0 == retCode; ++split )
+        {
+            Message message;
+            IncrementalDecoder decoder;
+            describe( message, decoder );
+
+            ConstByteStreambuf first{ wire.data(), std::streamsize( split ) };
+            ConstByteStreambuf second{ wire.data() + split, std::streamsize( len - split ) };
+            const auto firstStatus = decoder.decode( first );
+            const auto secondStatus = decoder.decode( second );
+            if ( ( len == split ) != ( IncrementalDecoder::Status::complete == firstStatus ) ||
+                 IncrementalDecoder::Status::complete != secondStatus || !( expected == message ) )
+            {
+                std::cout << "Decoding split at byte " << split << " did not match the message" << std::endl;
+                retCode = 2;
+            }
+        }
+        if ( 0 != retCode ) break;
+
+        // TEST A SEGMENT HOLDING MORE THAN ONE MESSAGE LEAVES THE NEXT MESSAGE UNCONSUMED
+        const Message second = makeMessage( 0, 0 );
+        serialize( second, out );
+        const size_t totalLen = size_t( out.position().pPut - wire.data() );
+        {
+            Message message;
+            IncrementalDecoder decoder;
+            describe( message, decoder );
+
+            ConstByteStreambuf segment{ wire.data(), std::streamsize( totalLen - 5 ) };
+            if ( IncrementalDecoder::Status::complete != decoder.decode( segment ) || !( expected == message ) ||
+                 wire.data() + len != segment.position().pGet )
+            {
+                std::cout << "The first of two messages did not decode, or decoding consumed past it" << std::endl;
+                retCode = 3;
+                break;
+            }
+
+            decoder.reset();
+            ConstByteStreambuf rest{ wire.data() + totalLen - 5, 5 };
+            if ( IncrementalDecoder::Status::incomplete != decoder.decode( segment ) ||
+                 IncrementalDecoder::Status::complete != decoder.decode( rest ) || !( second == message ) ||
+                 totalLen - len != decoder.consumed() )
+            {
+                std::cout << "The second of two messages, with empty variable length fields, did not decode" << std::endl;
+                retCode = 4;
+                break;
+            }
+        }
+
+        // TEST AN EMPTY SEGMENT CONSUMES NOTHING
+        {
+            Message message;
+            IncrementalDecoder decoder;
+            describe( message, decoder );
+            ConstByteStreambuf empty{ wire.data(), 0 };
+            if ( IncrementalDecoder::Status::incomplete != decoder.decode( empty ) || 0 != decoder.consumed() )
+            {
+                std::cout << "An empty segment was not reported incomplete" << std::endl;
+                retCode = 5;
+                break;
+            }
+        }
+
+        // TEST A COUNT EXCEEDING ITS MAXIMUM IS INVALID UNTIL RESET
+        {
+            std::vector< unsigned char > badWire( 4096 );
+            ByteStreambuf badOut{ badWire.data(), std::streamsize( badWire.size() ), std::ios_base::out };
+            serialize( makeMessage( 1001, 0 ), badOut );
+
+            Message message;
+            IncrementalDecoder decoder;
+            describe( message, decoder );
+            ConstByteStreambuf first{ badWire.data(), 10 };
+            ConstByteStreambuf rest{ badWire.data() + 10, 10 };
+            if ( IncrementalDecoder::Status::incomplete != decoder.decode( first ) ||
+                 IncrementalDecoder::Status::invalid != decoder.decode( rest ) ||
+                 IncrementalDecoder::Status::invalid != decoder.decode( rest ) || 19 != decoder.consumed() ||
+                 !message.samples.empty() )
+            {
+                std::cout << "A count exceeding its maximum was not reported invalid" << std::endl;
+                retCode = 6;
+                break;
+            }
+
+            decoder.reset();
+            ConstByteStreambuf good{ wire.data(), std::streamsize( len ) };
+            if ( IncrementalDecoder::Status::complete != decoder.decode( good ) || !( expected == message ) )
+            {
+                std::cout << "The decoder did not recover from an invalid message once reset" << std::endl;
+                retCode = 7;
+                break;
+            }
+        }
+    } while ( false );
+
+    return retCode;
+}
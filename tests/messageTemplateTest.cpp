@@ -0,0 +1,83 @@
+/**
+* @file messageTemplateTest.cpp
+* @brief Test Harness to Verify MessageTemplate Writing and In Place Field Patching
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "MessageTemplate.h"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // Build a heartbeat of a magic number, version, source identifier, sequence number, timestamp and trailer.
+        MessageTemplate heartbeat;
+        heartbeat.appendConstant( uint16_t( 0x4842 ) );
+        heartbeat.appendConstant( uint8_t( 3 ) );
+        heartbeat.appendConstant( uint32_t( 0xA1B2C3D4 ) );
+        const auto sequenceField = heartbeat.appendField< uint32_t >();
+        const auto timestampField = heartbeat.appendField< int64_t >( -1 );
+        const unsigned char trailer[] = { 0xDE, 0xAD };
+        heartbeat.appendBytes( trailer, sizeof( trailer ) );
+
+        if ( 21 != heartbeat.size() || 7 != sequenceField.offset() || 4 != sequenceField.width() ||
+             11 != timestampField.offset() || 8 != timestampField.width() )
+        {
+            std::cout << "Expected a 21 byte template with fields at offsets 7 and 11, got size "
+                      << heartbeat.size() << " and offsets " << sequenceField.offset() << " and "
+                      << timestampField.offset() << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Write two messages, patching the first only, the second retaining the initial values.
+        unsigned char buffer[50];
+        ByteStreambuf byteStreambuf{ buffer, sizeof( buffer ), std::ios::out };
+        unsigned char * pMessage = heartbeat.write( byteStreambuf );
+        if ( pMessage != buffer ) { retCode = 2; break; }
+        MessageTemplate::patch( pMessage, sequenceField, uint32_t( 0x01020304 ) );
+        MessageTemplate::patch( pMessage, timestampField, int64_t( 0x1122334455667788 ) );
+        if ( heartbeat.write( byteStreambuf ) != buffer + heartbeat.size() ) { retCode = 3; break; }
+
+        // The same messages serialized field by field.
+        unsigned char expected[50];
+        ByteStreambuf expectedStreambuf{ expected, sizeof( expected ), std::ios::out };
+        for ( int i = 0; 2 != i; ++i )
+        {
+            typeToNet( uint16_t( 0x4842 ), expectedStreambuf );
+            typeToNet( uint8_t( 3 ), expectedStreambuf );
+            typeToNet( uint32_t( 0xA1B2C3D4 ), expectedStreambuf );
+            typeToNet( 0 == i ? uint32_t( 0x01020304 ) : uint32_t( 0 ), expectedStreambuf );
+            typeToNet( 0 == i ? int64_t( 0x1122334455667788 ) : int64_t( -1 ), expectedStreambuf );
+            typeToNet( uint8_t( 0xDE ), expectedStreambuf );
+            typeToNet( uint8_t( 0xAD ), expectedStreambuf );
+        }
+        if ( 0 != memcmp( buffer, expected, 2 * heartbeat.size() ) )
+        {
+            std::cout << "Template messages differ from those serialized field by field!" << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // There are 8 bytes of room left. A write is all or nothing.
+        if ( nullptr != heartbeat.write( byteStreambuf ) ||
+             std::streamoff( 2 * heartbeat.size() ) != byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+        {
+            std::cout << "Expected a write without room to write nothing!" << std::endl;
+            retCode = 5;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
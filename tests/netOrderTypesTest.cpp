@@ -0,0 +1,97 @@
+/**
+* @file netOrderTypesTest.cpp
+* @brief Test Harness to Verify Network Ordered Overlay Types and viewAt Upon a ByteStreambuf
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "ConstByteStreambuf.h"
+#include "Serialization.h"
+#include "NetOrderTypes.h"
+
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    // An overlay needing no packing pragma.
+    struct Header
+    {
+        be_uint16 type;
+        be_uint32 sequence;
+        be_float64 sample;
+        unsigned char reserved[2];
+        be_int64 trailer;
+        be_float32 gain;
+        be_int16 offset;
+    };
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        if ( 30 != sizeof( Header ) || 1 != alignof( Header ) )
+        {
+            std::cout << "Expected a 30 byte overlay with an alignment of one, got " << sizeof( Header )
+                      << " bytes and alignment " << alignof( Header ) << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Serialize a message, preceded by two bytes of framing, field by field.
+        unsigned char buffer[40] = {};
+        ByteStreambuf outByteStreambuf{ buffer, sizeof( buffer ), std::ios::out };
+        typeToNet( uint16_t( 0xFFEE ), outByteStreambuf );
+        typeToNet( uint16_t( 0x0102 ), outByteStreambuf );
+        typeToNet( uint32_t( 0xDEADBEEF ), outByteStreambuf );
+        typeToNet( 3.25, outByteStreambuf );
+        typeToNet( uint16_t( 0 ), outByteStreambuf );
+        typeToNet( int64_t( -123456789012345LL ), outByteStreambuf );
+        typeToNet( 0.5f, outByteStreambuf );
+        typeToNet( int16_t( -2 ), outByteStreambuf );
+
+        // View it in place, reading only the fields touched.
+        ConstByteStreambuf constByteStreambuf{ buffer, 32 };
+        const Header * pHeader = viewAt< Header >( constByteStreambuf, 2 );
+        if ( !pHeader || 0x0102 != pHeader->type || 0xDEADBEEF != pHeader->sequence.get() ||
+             3.25 != pHeader->sample || -123456789012345LL != pHeader->trailer || 0.5f != pHeader->gain ||
+             -2 != pHeader->offset )
+        {
+            std::cout << "viewAt< Header > FAILED to read the fields in place!" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Viewing does not move the get position.
+        if ( 32 != constByteStreambuf.in_avail() ) { retCode = 3; break; }
+
+        // The overlay must lie wholly within the get area.
+        if ( nullptr != viewAt< Header >( constByteStreambuf, 3 ) ||
+             nullptr != viewAt< Header >( constByteStreambuf, 33 ) ||
+             nullptr != viewAt< Header >( constByteStreambuf, size_t( -1 ) ) )
+        {
+            std::cout << "Expected viewAt beyond the get area to return nullptr!" << std::endl;
+            retCode = 4;
+            break;
+        }
+        if ( nullptr == viewAt< be_uint16 >( constByteStreambuf, 30 ) ) { retCode = 5; break; }
+
+        // Overlays may be written through too, storing network order.
+        Header header;
+        header.sequence = 0x01020304;
+        header.gain.set( -1.5f );
+        unsigned char * pBytes = reinterpret_cast< unsigned char * >( &header );
+        ByteStreambuf inByteStreambuf{ pBytes, sizeof( header ), std::ios::in };
+        inByteStreambuf.pubseekpos( 2, std::ios_base::in );
+        if ( 0x01020304 != netToType< uint32_t >( inByteStreambuf ) ) { retCode = 6; break; }
+        inByteStreambuf.pubseekpos( 24, std::ios_base::in );
+        if ( -1.5f != netToType< float >( inByteStreambuf ) ) { retCode = 7; break; }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,151 @@
+/**
+* @file parallelSerializerTest.cpp
+* @brief Test Harness to Verify Parallel Serialization is Byte Identical to Serial Serialization
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "ParallelSerializer.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    struct Record
+    {
+        uint32_t id;
+        double value;
+        std::string name;
+    };
+
+    size_t wireSize( const Record & record )
+    {
+        return sizeof( record.id ) + sizeof( record.value ) + sizeof( uint16_t ) + record.name.size();
+    }
+
+    void write( const Record & record, ByteStreambuf & byteStreambuf )
+    {
+        typeToNet( record.id, byteStreambuf );
+        typeToNet( record.value, byteStreambuf );
+        typeToNet( uint16_t( record.name.size() ), byteStreambuf );
+        byteStreambuf.sputn( reinterpret_cast< const unsigned char * >( record.name.data() ),
+                             std::streamsize( record.name.size() ) );
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // Records of varying size, some empty named.
+        std::vector< Record > records( 5000 );
+        for ( size_t i = 0; records.size() != i; ++i )
+            records[i] = Record{ uint32_t( i ), double( i ) * 0.25, std::string( i * 7 % 61, char( 'a' + i % 26 ) ) };
+
+        size_t total = 0;
+        for ( const auto & record : records ) total += wireSize( record );
+        std::vector< unsigned char > serial( total );
+        ByteStreambuf serialByteStreambuf{ serial.data(), std::streamsize( serial.size() ), std::ios_base::out };
+        for ( const auto & record : records ) write( record, serialByteStreambuf );
+
+        auto sizeFunction = [&]( size_t i ) { return wireSize( records[i] ); };
+        auto writeFunction = [&]( size_t i, ByteStreambuf & region ) { write( records[i], region ); };
+
+        // TEST OUTPUT IS BYTE IDENTICAL FOR VARIOUS THREAD COUNTS, AFTER A PREFIX ALREADY WRITTEN
+        bool failed = false;
+        const unsigned threadCounts[] = { 1, 2, 3, 4, 7, 16 };
+        for ( auto numThreads : threadCounts )
+        {
+            ParallelSerializer serializer( numThreads );
+            if ( total != serializer.plan( records.size(), sizeFunction ) ||
+                 records.size() + 1 != serializer.offsets().size() )
+            {
+                std::cout << "Planning FAILED with " << numThreads << " threads!" << std::endl;
+                failed = true;
+                break;
+            }
+
+            std::vector< unsigned char > parallel( total + 8, 0xEE );
+            ByteStreambuf byteStreambuf{ parallel.data(), std::streamsize( parallel.size() ), std::ios_base::out };
+            typeToNet( uint32_t( 0xFEEDFACE ), byteStreambuf );
+            if ( !serializer.serialize( byteStreambuf, writeFunction ) ||
+                 std::streamoff( total + 4 ) != byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) ||
+                 !std::equal( serial.begin(), serial.end(), parallel.begin() + 4 ) || 0xEE != parallel[ total + 4 ] )
+            {
+                std::cout << "Parallel output with " << numThreads << " threads differs from serial output!" << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if ( failed ) { retCode = 1; break; }
+
+        // TEST AN EMPTY BATCH AND A BATCH WITHOUT ROOM
+        {
+            ParallelSerializer serializer( 4 );
+            std::vector< unsigned char > buffer( 16 );
+            ByteStreambuf byteStreambuf{ buffer.data(), std::streamsize( buffer.size() ), std::ios_base::out };
+            if ( 0 != serializer.plan( 0, sizeFunction ) || !serializer.serialize( byteStreambuf, writeFunction ) ||
+                 0 == serializer.plan( 10, sizeFunction ) || serializer.serialize( byteStreambuf, writeFunction ) ||
+                 0 != byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+            {
+                std::cout << "Empty batch or batch without room FAILED!" << std::endl;
+                retCode = 2;
+                break;
+            }
+        }
+
+        // TEST A RECORD NOT MATCHING ITS PLANNED SIZE FAILS THE BATCH
+        {
+            ParallelSerializer serializer( 4 );
+            serializer.plan( records.size(), sizeFunction );
+            std::vector< unsigned char > buffer( total );
+            ByteStreambuf byteStreambuf{ buffer.data(), std::streamsize( buffer.size() ), std::ios_base::out };
+            auto shortWrite = [&]( size_t i, ByteStreambuf & region )
+            {
+                if ( 3333 == i ) typeToNet( records[i].id, region );
+                else write( records[i], region );
+            };
+            if ( serializer.serialize( byteStreambuf, shortWrite ) ||
+                 0 != byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+            {
+                std::cout << "Expected a record of the wrong size to fail the batch!" << std::endl;
+                retCode = 3;
+                break;
+            }
+
+            // TEST AN EXCEPTION IN A WORKER IS RETHROWN TO THE CALLER
+            auto throwingWrite = [&]( size_t i, ByteStreambuf & region )
+            {
+                if ( 4999 == i ) throw std::runtime_error( "record 4999" );
+                write( records[i], region );
+            };
+            bool caught = false;
+            try
+            {
+                serializer.serialize( byteStreambuf, throwingWrite );
+            }
+            catch ( const std::runtime_error & e )
+            {
+                caught = std::string( "record 4999" ) == e.what();
+            }
+            if ( !caught || 0 != byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+            {
+                std::cout << "Expected an exception from a worker to be rethrown!" << std::endl;
+                retCode = 4;
+                break;
+            }
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,172 @@
+/**
+* @file quantizedFloatTest.cpp
+* @brief Test Harness to Verify Half Precision and Fixed Point Float Array Serialization
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "QuantizedFloat.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    // A mix of magnitudes spanning subnormal halves to beyond the half range, and special values.
+    std::vector< float > makeValues( size_t count )
+    {
+        std::vector< float > values( count );
+        uint32_t seed = 12345;
+        for ( auto & value : values )
+        {
+            seed = seed * 1103515245 + 12345;
+            const float unit = float( seed >> 8 ) / float( 1 << 24 ) - 0.5f;
+            value = std::ldexp( unit, int( seed % 48 ) - 28 );
+        }
+        values[3] = std::numeric_limits< float >::infinity();
+        values[5] = -std::numeric_limits< float >::infinity();
+        values[7] = std::numeric_limits< float >::quiet_NaN();
+        values[11] = -0.0f;
+        values[13] = 65519.0f;
+        values[17] = 65520.0f;
+        return values;
+    }
+
+    int32_t referenceFixed( float value, float scale, double lo, double hi )
+    {
+        double x = double( value * scale );
+        if ( x != x ) x = 0.0;
+        x = x < lo ? lo : ( x > hi ? hi : x );
+        return int32_t( std::nearbyint( x ) );
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        std::cout << "F16C in use " << QuantizedFloat::usingF16c() << std::endl;
+
+        // TEST EVERY HALF ROUND TRIPS THROUGH FLOAT
+        bool failed = false;
+        for ( uint32_t h = 0; 0x10000 != h; ++h )
+        {
+            const float f = QuantizedFloat::halfToFloat( uint16_t( h ) );
+            const bool isNaN = 0x7C00 == ( h & 0x7C00 ) && 0 != ( h & 0x3FF );
+            if ( isNaN ? f == f : QuantizedFloat::floatToHalf( f ) != h )
+            {
+                std::cout << "Half 0x" << std::hex << h << " FAILED to round trip!" << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if ( failed ) { retCode = 1; break; }
+
+        // TEST ROUNDING, OVERFLOW AND SUBNORMALS
+        struct { float value; uint16_t half; } cases[] = {
+            { 1.0f, 0x3C00 }, { -2.0f, 0xC000 }, { 65504.0f, 0x7BFF }, { 65519.0f, 0x7BFF }, { 65520.0f, 0x7C00 },
+            { 1.0e10f, 0x7C00 }, { std::ldexp( 1.0f, -24 ), 0x0001 }, { std::ldexp( 1.0f, -25 ), 0x0000 },
+            { std::ldexp( 3.0f, -25 ), 0x0002 }, { -0.0f, 0x8000 }, { 1.0f + std::ldexp( 1.0f, -11 ), 0x3C00 },
+            { 1.0f + std::ldexp( 3.0f, -11 ), 0x3C02 }, { std::ldexp( 1.0f, -14 ), 0x0400 }
+        };
+        for ( const auto & c : cases )
+        {
+            if ( c.half != QuantizedFloat::floatToHalf( c.value ) )
+            {
+                std::cout << "floatToHalf( " << c.value << " ) FAILED! Expected 0x" << std::hex << c.half
+                          << ", got 0x" << QuantizedFloat::floatToHalf( c.value ) << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if ( failed ) { retCode = 2; break; }
+
+        // TEST ARRAYS MATCH THE PORTABLE CONVERSION, WHICHEVER PATH IS TAKEN
+        const size_t count = 1003;
+        const auto values = makeValues( count );
+        std::vector< unsigned char > buffer( 4 * count + 8 );
+        ByteStreambuf byteStreambuf{ buffer.data(), std::streamsize( buffer.size() ) };
+        if ( 2 * count != QuantizedFloat::halfToNet( values.data(), count, byteStreambuf ) ) { retCode = 3; break; }
+        for ( size_t i = 0; count != i && !failed; ++i )
+            failed = QuantizedFloat::floatToHalf( values[i] ) != _loadNetOrder< uint16_t >( &buffer[ 2 * i ] );
+        if ( failed )
+        {
+            std::cout << "halfToNet differs from floatToHalf!" << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        std::vector< float > decoded( count );
+        if ( 2 * count != QuantizedFloat::netToHalf( byteStreambuf, decoded.data(), count ) ) { retCode = 5; break; }
+        for ( size_t i = 0; count != i && !failed; ++i )
+        {
+            const float expected = QuantizedFloat::halfToFloat( QuantizedFloat::floatToHalf( values[i] ) );
+            failed = expected == expected ? 0 != memcmp( &expected, &decoded[i], sizeof( float ) ) : decoded[i] == decoded[i];
+        }
+        if ( failed )
+        {
+            std::cout << "netToHalf differs from halfToFloat!" << std::endl;
+            retCode = 6;
+            break;
+        }
+
+        // TEST FIXED POINT OF EACH WIDTH, SATURATING
+        const unsigned widths[] = { 1, 2, 4 };
+        const double limits[] = { 127.0, 32767.0, 2147483520.0 };
+        for ( unsigned w = 0; 3 != w && !failed; ++w )
+        {
+            const unsigned width = widths[w];
+            const float scale = 1 == width ? 1.0f : 256.0f;
+            const double hi = limits[w];
+            const double lo = 4 == width ? -2147483648.0 : -hi - 1.0;
+
+            byteStreambuf.pubseekpos( 0 );
+            if ( width * count != QuantizedFloat::fixedToNet( values.data(), count, scale, width, byteStreambuf ) ||
+                 width * count != QuantizedFloat::netToFixed( byteStreambuf, decoded.data(), count, scale, width ) )
+            {
+                std::cout << "Fixed point of width " << width << " FAILED to serialize!" << std::endl;
+                failed = true;
+                break;
+            }
+            for ( size_t i = 0; count != i; ++i )
+            {
+                const int32_t expected = referenceFixed( values[i], scale, lo, hi );
+                int32_t actual;
+                if ( 1 == width ) actual = _loadNetOrder< int8_t >( &buffer[i] );
+                else if ( 2 == width ) actual = _loadNetOrder< int16_t >( &buffer[ 2 * i ] );
+                else actual = _loadNetOrder< int32_t >( &buffer[ 4 * i ] );
+                if ( expected != actual || float( expected ) / scale != decoded[i] )
+                {
+                    std::cout << "Fixed point of width " << width << " FAILED at " << i << "! Expected " << expected
+                              << ", got " << actual << std::endl;
+                    failed = true;
+                    break;
+                }
+            }
+        }
+        if ( failed ) { retCode = 7; break; }
+
+        // TEST ALL OR NOTHING AND BAD WIDTHS
+        byteStreambuf.pubseekpos( buffer.size() - 6 );
+        if ( 0 != QuantizedFloat::halfToNet( values.data(), 4, byteStreambuf ) ||
+             0 != QuantizedFloat::fixedToNet( values.data(), 2, 1.0f, 4, byteStreambuf ) ||
+             0 != QuantizedFloat::fixedToNet( values.data(), 1, 1.0f, 3, byteStreambuf ) ||
+             std::streamoff( buffer.size() - 6 ) != byteStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+        {
+            std::cout << "Expected serialization without room or with a bad width to write nothing!" << std::endl;
+            retCode = 8;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,161 @@
+/**
+* @file recordIndexTest.cpp
+* @brief Test Harness to Verify RecordIndexBuilder and RecordIndex
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "RecordIndex.h"
+
+#include <vector>
+#include <stdexcept>
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // Build a data block of length prefixed records of varying sizes. We use more than one
+        // block's worth of records so that block table lookups are exercised.
+        constexpr uint32_t numRecords = 200;
+        std::vector< unsigned char > data( numRecords * ( sizeof( uint32_t ) + 300 ) );
+        std::vector< uint64_t > expectedOffsets;
+        ByteStreambuf dataStreambuf{ data.data(), std::streamsize( data.size() ) };
+        OutputByteStream dataOutStream{ &dataStreambuf };
+        for ( uint32_t i = 0; numRecords != i; ++i )
+        {
+            expectedOffsets.push_back( uint64_t( dataOutStream.tellp() ) );
+            const uint32_t payloadLength = ( i * 37 ) % 300;
+            typeToNet( payloadLength, dataOutStream );
+            for ( uint32_t j = 0; payloadLength != j; ++j )
+                dataOutStream.put( (unsigned char)( i ) );
+        }
+        const auto dataLength = std::streamsize( dataOutStream.tellp() );
+
+        // Add a truncated record at the end which should not be indexed.
+        typeToNet( uint32_t( 1000 ), dataOutStream );
+        if ( !dataOutStream )
+        {
+            std::cout << "Failed to construct test data!" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Build the index over the data written.
+        unsigned char indexBuffer[ 1024 ];
+        ByteStreambuf indexStreambuf{ indexBuffer, sizeof( indexBuffer ), std::ios::out };
+        OutputByteStream indexStream{ &indexStreambuf };
+        RecordIndexBuilder builder{ indexStream };
+
+        ByteStreambuf dataInStreambuf{ data.data(), dataLength + std::streamsize( sizeof( uint32_t ) ), std::ios::in };
+        InputByteStream dataInStream{ &dataInStreambuf };
+        const auto numIndexed = builder.addRecords( dataInStream );
+        if ( numRecords != numIndexed )
+        {
+            std::cout << "Expected " << numRecords << " records indexed. Found " << numIndexed << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        const auto indexLength = builder.finish();
+        if ( 0 == indexLength || uint64_t( indexStream.tellp() ) != indexLength )
+        {
+            std::cout << "Expected finish to report " << indexStream.tellp() << " index bytes. Found "
+                      << indexLength << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // The index should be considerably smaller than 8 bytes per record.
+        if ( numRecords * sizeof( uint64_t ) <= indexLength )
+        {
+            std::cout << "Expected a compact index. Found " << indexLength << " bytes for "
+                      << numRecords << " records" << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // Open the index and verify every offset.
+        RecordIndex recordIndex{ indexBuffer, size_t( indexLength ) };
+        if ( numRecords != recordIndex.size() )
+        {
+            std::cout << "Expected index size of " << numRecords << ". Found " << recordIndex.size() << std::endl;
+            retCode = 5;
+            break;
+        }
+        for ( uint32_t i = 0; numRecords != i; ++i )
+        {
+            if ( expectedOffsets[i] != recordIndex.offset( i ) )
+            {
+                std::cout << "Expected offset " << expectedOffsets[i] << " for record " << i
+                          << ". Found " << recordIndex.offset( i ) << std::endl;
+                retCode = 6;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Jump straight to a record in the data and verify its content.
+        dataInStream.clear();
+        const uint32_t recordNumber = 150;
+        if ( !recordIndex.seek( dataInStream, recordNumber ) )
+        {
+            std::cout << "Failed to seek to record " << recordNumber << std::endl;
+            retCode = 7;
+            break;
+        }
+        const auto payloadLength = netToType< uint32_t >( dataInStream );
+        const auto firstPayloadByte = (unsigned char)dataInStream.get();
+        if ( ( recordNumber * 37 ) % 300 != payloadLength || (unsigned char)recordNumber != firstPayloadByte )
+        {
+            std::cout << "Unexpected record content after seek. Length " << payloadLength
+                      << ", first byte " << (unsigned int)firstPayloadByte << std::endl;
+            retCode = 8;
+            break;
+        }
+
+        // Out of range lookups should throw and seeks should fail.
+        try
+        {
+            recordIndex.offset( numRecords );
+            std::cout << "Expected std::out_of_range to be thrown and that did not occur!" << std::endl;
+            retCode = 9;
+            break;
+        }
+        catch ( const std::out_of_range & ) {}
+
+        if ( recordIndex.seek( dataInStream, numRecords ) )
+        {
+            std::cout << "Expected seek beyond the last record to fail!" << std::endl;
+            retCode = 10;
+            break;
+        }
+
+        // A corrupted footer should be rejected.
+        indexBuffer[ indexLength - 1 ] ^= 0xFF;
+        try
+        {
+            RecordIndex badIndex{ indexBuffer, size_t( indexLength ) };
+            std::cout << "Expected std::invalid_argument to be thrown and that did not occur!" << std::endl;
+            retCode = 11;
+            break;
+        }
+        catch ( const std::invalid_argument & ) {}
+
+        // Seeking to the very end of a buffer is a valid position.
+        dataInStream.clear();
+        if ( !dataInStream.seekg( 0, std::ios_base::end ) )
+        {
+            std::cout << "Expected seek to the end of the stream buffer to succeed!" << std::endl;
+            retCode = 12;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,186 @@
+/**
+* @file shmChannelTest.cpp
+* @brief Test Harness to Verify a Shared Memory Channel Between Two Processes
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "ShmChannel.h"
+
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+#include <system_error>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    constexpr uint32_t numMessages = 100000;
+
+    // Each message is its sequence number followed by that many bytes, modulo 40, of a pattern.
+    int consume( ShmChannel & channel )
+    {
+        uint32_t expected = 0;
+        while ( InputByteStream * pMessage = channel.receive() )
+        {
+            const uint32_t sequence = netToType< uint32_t >( *pMessage );
+            if ( !*pMessage || expected != sequence ) return 10;
+            for ( uint32_t i = 0; sequence % 40 != i; ++i )
+                if ( static_cast< unsigned char >( sequence + i ) != pMessage->get() ) return 11;
+            if ( std::char_traits< unsigned char >::eof() != pMessage->get() ) return 12;
+            channel.release();
+            ++expected;
+        }
+        return numMessages == expected ? 0 : 13;
+    }
+
+    int waitForChild( pid_t pid )
+    {
+        int status = 0;
+        if ( pid != waitpid( pid, &status, 0 ) || !WIFEXITED( status ) ) return -1;
+        return WEXITSTATUS( status );
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // TEST TIMEOUTS UPON AN EMPTY AND A FULL RING
+        {
+            ShmChannel channel( 64, 3 );
+            if ( 4 != channel.numSlots() || nullptr != channel.receive( ShmChannel::Timeout::zero() ) ||
+                 nullptr != channel.receive( std::chrono::milliseconds( 5 ) ) )
+            {
+                std::cout << "Expected receiving from an empty channel to time out!" << std::endl;
+                retCode = 1;
+                break;
+            }
+            for ( int i = 0; 4 != i; ++i )
+            {
+                typeToNet( uint32_t( i ), *channel.acquire() );
+                channel.publish();
+            }
+            if ( nullptr != channel.acquire( std::chrono::milliseconds( 5 ) ) )
+            {
+                std::cout << "Expected acquiring from a full channel to time out!" << std::endl;
+                retCode = 2;
+                break;
+            }
+        }
+
+        // TEST A CHILD PROCESS RECEIVES EVERY MESSAGE, IN ORDER, THROUGH A SMALL RING
+        {
+            ShmChannel channel( 64, 8 );
+            std::cout.flush();
+            const pid_t pid = fork();
+            if ( 0 == pid )
+            {
+                // Attach by descriptor, as an unrelated process handed the descriptor would.
+                ShmChannel consumer( channel.fd() );
+                _exit( consume( consumer ) );
+            }
+
+            for ( uint32_t sequence = 0; numMessages != sequence; ++sequence )
+            {
+                ByteStreambuf * pSlot = channel.acquire();
+                typeToNet( sequence, *pSlot );
+                for ( uint32_t i = 0; sequence % 40 != i; ++i ) pSlot->sputc( static_cast< unsigned char >( sequence + i ) );
+                channel.publish();
+            }
+            channel.close();
+
+            const int childCode = waitForChild( pid );
+            if ( 0 != childCode )
+            {
+                std::cout << "Consumer process FAILED with " << childCode << "!" << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+
+        // TEST A NAMED CHANNEL, AND ATTACHING TO SOMETHING THAT IS NOT A CHANNEL
+        {
+            const std::string name = "/ReiserRT_shmChannelTest_" + std::to_string( getpid() );
+            ShmChannel producer( name.c_str(), 128, 16 );
+            ShmChannel consumer( name.c_str() );
+            ShmChannel::remove( name.c_str() );
+
+            typeToNet( 3.5, *producer.acquire() );
+            producer.publish();
+            InputByteStream * pMessage = consumer.receive( std::chrono::milliseconds( 100 ) );
+            if ( 128 != consumer.slotSize() || !pMessage || 3.5 != netToType< double >( consumer.streambuf() ) )
+            {
+                std::cout << "Named channel FAILED!" << std::endl;
+                retCode = 4;
+                break;
+            }
+
+            // A failed creation must not leave the name behind to make the next attempt fail.
+            const std::string failedName = name + "_failed";
+            bool threw = false;
+            try
+            {
+                ShmChannel invalid( failedName.c_str(), 128, 0 );
+            }
+            catch ( const std::system_error & )
+            {
+                threw = true;
+            }
+            if ( !threw || ShmChannel::remove( failedName.c_str() ) )
+            {
+                std::cout << "Expected an invalid named channel to throw and leave no name behind!" << std::endl;
+                retCode = 6;
+                break;
+            }
+        }
+
+        bool threw = false;
+        const int nullFd = open( "/dev/null", O_RDWR );
+        try
+        {
+            ShmChannel notAChannel( nullFd );
+        }
+        catch ( const std::system_error & )
+        {
+            threw = true;
+        }
+        close( nullFd );
+
+        // Hostile geometry, where the slot size wraps past the stride, exceeds a length prefix or the stride is
+        // shorter than the prefix. The slot size is at offset 8 of the header and the stride at 16.
+        const struct { off_t offset; uint64_t value; } hostile[] = {
+            { 8, UINT64_MAX - 7 }, { 8, uint64_t( UINT32_MAX ) + 1 }, { 16, 4 } };
+        for ( const auto & field : hostile )
+        {
+            ShmChannel victim( 128, 16 );
+            bool fieldThrew = false;
+            try
+            {
+                if ( sizeof( field.value ) == pwrite( victim.fd(), &field.value, sizeof( field.value ), field.offset ) )
+                    ShmChannel notAChannel( victim.fd() );
+            }
+            catch ( const std::system_error & )
+            {
+                fieldThrew = true;
+            }
+            threw = threw && fieldThrew;
+        }
+        if ( !threw )
+        {
+            std::cout << "Expected attaching to something that is not a channel to throw!" << std::endl;
+            retCode = 5;
+            break;
+        }
+
+    } while( false );
+
+    return retCode;
+}
@@ -0,0 +1,164 @@
+/**
+* @file slabArenaTest.cpp
+* @brief Test Harness to Verify a Slab Arena Hands Out Distinct Aligned Blocks, Concurrently
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "SlabArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // TEST EVERY BLOCK IS ALLOCATED ONCE, ALIGNED AND WITHIN THE ARENA, UNTIL THE ARENA IS EXHAUSTED
+        SlabArena arena{ 1000, 100 };
+        std::cout << "Block size " << arena.blockSize() << ", huge pages " << ( arena.hugePages() ? "reserved" : "requested" )
+                  << ", NUMA node " << arena.numaNode() << std::endl;
+        if ( 1024 != arena.blockSize() || 1088 != arena.blockStride() || 100 != arena.numBlocks() )
+        {
+            std::cout << "Expected 100 blocks of 1024 bytes, 1088 bytes apart, got " << arena.numBlocks() << " of "
+                      << arena.blockSize() << ", " << arena.blockStride() << " bytes apart" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        std::vector< unsigned char * > blocks;
+        while ( unsigned char * pBlock = arena.allocate() ) blocks.push_back( pBlock );
+        std::vector< unsigned char * > sorted( blocks );
+        std::sort( sorted.begin(), sorted.end() );
+        bool distinct = std::adjacent_find( sorted.begin(), sorted.end() ) == sorted.end();
+        bool aligned = std::all_of( blocks.begin(), blocks.end(), []( unsigned char * p )
+            { return 0 == reinterpret_cast< uintptr_t >( p ) % SlabArena::cacheLineSize; } );
+        if ( 100 != blocks.size() || !distinct || !aligned ||
+             size_t( sorted.back() - sorted.front() ) != 99 * arena.blockStride() )
+        {
+            std::cout << "Expected 100 distinct, aligned and contiguous blocks, got " << blocks.size() << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // TEST EVERY BLOCK IS WRITABLE IN FULL THROUGH A BYTESTREAMBUF
+        bool intact = true;
+        for ( size_t i = 0; blocks.size() != i; ++i )
+        {
+            ByteStreambuf byteStreambuf = arena.streambuf( blocks[i] );
+            for ( uint32_t n = 0; 256 != n; ++n ) typeToNet( uint32_t( i * 256 + n ), byteStreambuf );
+            if ( nullptr != byteStreambuf.claimPutBytes( 1 ) ) intact = false;
+        }
+        for ( size_t i = 0; blocks.size() != i && intact; ++i )
+        {
+            ByteStreambuf byteStreambuf = arena.streambuf( blocks[i], std::ios_base::in );
+            for ( uint32_t n = 0; 256 != n; ++n )
+                if ( uint32_t( i * 256 + n ) != netToType< uint32_t >( byteStreambuf ) ) intact = false;
+        }
+        if ( !intact )
+        {
+            std::cout << "A ByteStreambuf over a block did not span exactly the block, or blocks overlapped" << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // TEST DEALLOCATED BLOCKS ARE ALLOCATED AGAIN
+        arena.deallocate( blocks[7] );
+        arena.deallocate( blocks[42] );
+        arena.deallocate( nullptr );
+        unsigned char * pFirst = arena.allocate();
+        unsigned char * pSecond = arena.allocate();
+        if ( blocks[42] != pFirst || blocks[7] != pSecond || nullptr != arena.allocate() )
+        {
+            std::cout << "Deallocated blocks were not allocated again, most recent first" << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // TEST DEALLOCATING A POINTER WHICH IS NOT A BLOCK THROWS
+        int numThrown = 0;
+        unsigned char notABlock[ 64 ];
+        for ( unsigned char * p : { notABlock, blocks[0] + 1, sorted.back() + arena.blockStride() } )
+        {
+            try { arena.deallocate( p ); }
+            catch ( const std::invalid_argument & ) { ++numThrown; }
+        }
+        if ( 3 != numThrown )
+        {
+            std::cout << "Expected 3 invalid deallocations to throw, " << numThrown << " did" << std::endl;
+            retCode = 5;
+            break;
+        }
+        for ( unsigned char * pBlock : blocks ) arena.deallocate( pBlock );
+
+        // TEST INVALID CONSTRUCTION THROWS
+        numThrown = 0;
+        try { SlabArena zeroSize{ 0, 10 }; } catch ( const std::invalid_argument & ) { ++numThrown; }
+        try { SlabArena zeroCount{ 64, 0 }; } catch ( const std::invalid_argument & ) { ++numThrown; }
+        try { SlabArena tooMany{ 64, size_t( UINT32_MAX ) }; } catch ( const std::invalid_argument & ) { ++numThrown; }
+        if ( 3 != numThrown )
+        {
+            std::cout << "Expected 3 invalid constructions to throw, " << numThrown << " did" << std::endl;
+            retCode = 6;
+            break;
+        }
+
+        // TEST CONCURRENT ALLOCATION NEVER HANDS ONE BLOCK TO TWO THREADS
+        // Each thread stamps the blocks it holds and checks the stamp is intact before deallocating them.
+        constexpr unsigned numThreads = 4;
+        constexpr size_t numRounds = 20000;
+        SlabArena shared{ 64, 16 };
+        std::atomic< size_t > numCorrupt{ 0 };
+        std::atomic< size_t > numAllocated{ 0 };
+        std::vector< std::thread > threads;
+        for ( unsigned t = 0; numThreads != t; ++t )
+        {
+            threads.emplace_back( [&, t]()
+            {
+                unsigned char * held[3];
+                for ( size_t round = 0; numRounds != round; ++round )
+                {
+                    size_t numHeld = 0;
+                    for ( ; 3 != numHeld; ++numHeld )
+                    {
+                        held[ numHeld ] = shared.allocate();
+                        if ( !held[ numHeld ] ) break;
+                        std::memset( held[ numHeld ], int( t + 1 ), shared.blockSize() );
+                    }
+                    numAllocated += numHeld;
+                    std::this_thread::yield();
+                    for ( size_t h = 0; numHeld != h; ++h )
+                    {
+                        if ( std::any_of( held[h], held[h] + shared.blockSize(),
+                                          [t]( unsigned char c ) { return t + 1 != c; } ) )
+                            ++numCorrupt;
+                        shared.deallocate( held[h] );
+                    }
+                }
+            } );
+        }
+        for ( auto & thread : threads ) thread.join();
+
+        size_t numFree = 0;
+        while ( shared.allocate() ) ++numFree;
+        if ( 0 != numCorrupt || 16 != numFree || 0 == numAllocated )
+        {
+            std::cout << "Concurrent allocation corrupted " << numCorrupt << " blocks and left " << numFree
+                      << " of 16 free" << std::endl;
+            retCode = 7;
+            break;
+        }
+    } while ( false );
+
+    return retCode;
+}
@@ -0,0 +1,213 @@
+/**
+* @file textTranscodingTest.cpp
+* @brief Test Harness to Verify Hex and Base64 Transcoding of ByteStreambuf Regions
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "TextTranscoding.h"
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+using namespace ReiserRT::Utility;
+
+namespace
+{
+    std::string referenceHex( const unsigned char * pBytes, size_t len )
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string text;
+        for ( size_t i = 0; len != i; ++i ) { text += digits[ pBytes[i] >> 4 ]; text += digits[ pBytes[i] & 0xF ]; }
+        return text;
+    }
+
+    std::string referenceBase64( const unsigned char * pBytes, size_t len )
+    {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::string text;
+        for ( size_t i = 0; i < len; i += 3 )
+        {
+            const size_t n = len - i < 3 ? len - i : 3;
+            uint32_t v = uint32_t( pBytes[i] ) << 16;
+            if ( n > 1 ) v |= uint32_t( pBytes[ i + 1 ] ) << 8;
+            if ( n > 2 ) v |= pBytes[ i + 2 ];
+            text += alphabet[ v >> 18 ];
+            text += alphabet[ ( v >> 12 ) & 0x3F ];
+            text += n > 1 ? alphabet[ ( v >> 6 ) & 0x3F ] : '=';
+            text += n > 2 ? alphabet[ v & 0x3F ] : '=';
+        }
+        return text;
+    }
+
+    const unsigned char * bytesOf( const std::string & text )
+    {
+        return reinterpret_cast< const unsigned char * >( text.data() );
+    }
+
+    std::string written( const std::vector< unsigned char > & buffer, size_t len )
+    {
+        return std::string( reinterpret_cast< const char * >( buffer.data() ), len );
+    }
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        std::cout << "AVX2 in use " << TextTranscoding::usingAvx2() << ", SSSE3 in use "
+                  << TextTranscoding::usingSsse3() << std::endl;
+
+        // Every byte value appears, and lengths cover each vector block size and remainder.
+        std::vector< unsigned char > bytes( 300 );
+        for ( size_t i = 0; bytes.size() != i; ++i ) bytes[i] = static_cast< unsigned char >( i * 167 + 13 );
+        std::vector< unsigned char > textBuffer( 1024 );
+        std::vector< unsigned char > byteBuffer( 512 );
+
+        // TEST ENCODING MATCHES THE REFERENCE AND DECODING ROUND TRIPS, AT EVERY LENGTH
+        bool failed = false;
+        for ( size_t len = 0; bytes.size() >= len && !failed; ++len )
+        {
+            ByteStreambuf text{ textBuffer.data(), std::streamsize( textBuffer.size() ) };
+            ByteStreambuf decoded{ byteBuffer.data(), std::streamsize( byteBuffer.size() ) };
+
+            const std::string hex = referenceHex( bytes.data(), len );
+            if ( hex.size() != TextTranscoding::hexEncode( bytes.data(), len, text ) ||
+                 hex != written( textBuffer, hex.size() ) ||
+                 len != TextTranscoding::hexDecode( textBuffer.data(), hex.size(), decoded ) ||
+                 0 != memcmp( bytes.data(), byteBuffer.data(), len ) )
+            {
+                std::cout << "Hex transcoding FAILED for length " << len << "!" << std::endl;
+                failed = true;
+                break;
+            }
+
+            text.pubseekpos( 0 );
+            decoded.pubseekpos( 0 );
+            const std::string base64 = referenceBase64( bytes.data(), len );
+            if ( base64.size() != TextTranscoding::base64Encode( bytes.data(), len, text ) ||
+                 base64 != written( textBuffer, base64.size() ) ||
+                 len != TextTranscoding::base64Decode( textBuffer.data(), base64.size(), decoded ) ||
+                 0 != memcmp( bytes.data(), byteBuffer.data(), len ) )
+            {
+                std::cout << "Base64 transcoding FAILED for length " << len << "!" << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if ( failed ) { retCode = 1; break; }
+
+        // TEST RFC 4648 VECTORS AND UPPERCASE HEX
+        const char * vectors[][2] = { { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" }, { "foob", "Zm9vYg==" },
+                                      { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" } };
+        for ( const auto & vector : vectors )
+        {
+            ByteStreambuf decoded{ byteBuffer.data(), std::streamsize( byteBuffer.size() ) };
+            std::string base64 = vector[1];
+            ByteStreambuf in{ reinterpret_cast< unsigned char * >( &base64[0] ), std::streamsize( base64.size() ),
+                              std::ios_base::in };
+            if ( strlen( vector[0] ) != TextTranscoding::base64DecodeReadable( in, decoded ) ||
+                 std::streamoff( base64.size() ) != in.pubseekoff( 0, std::ios_base::cur, std::ios_base::in ) ||
+                 vector[0] != written( byteBuffer, strlen( vector[0] ) ) )
+            {
+                std::cout << "Base64 decoding of " << base64 << " FAILED!" << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if ( failed ) { retCode = 2; break; }
+
+        {
+            ByteStreambuf decoded{ byteBuffer.data(), std::streamsize( byteBuffer.size() ) };
+            const std::string hex = "DEADbeef00FF";
+            if ( 6 != TextTranscoding::hexDecode( bytesOf( hex ), hex.size(), decoded ) ||
+                 0xDE != byteBuffer[0] || 0xEF != byteBuffer[3] || 0xFF != byteBuffer[5] )
+            {
+                std::cout << "Uppercase hex decoding FAILED!" << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+
+        // TEST AN INVALID CHARACTER ANYWHERE IS REJECTED WITHOUT ADVANCING
+        const std::string goodHex = referenceHex( bytes.data(), 150 );
+        const std::string goodBase64 = referenceBase64( bytes.data(), 150 );
+        for ( size_t i = 0; goodHex.size() != i && !failed; ++i )
+        {
+            ByteStreambuf decoded{ byteBuffer.data(), std::streamsize( byteBuffer.size() ) };
+            std::string hex = goodHex;
+            hex[i] = 0 == i % 3 ? 'g' : ( 1 == i % 3 ? '/' : char( 0xC1 ) );
+            failed = 0 != TextTranscoding::hexDecode( bytesOf( hex ), hex.size(), decoded ) ||
+                     0 != decoded.pubseekoff( 0, std::ios_base::cur, std::ios_base::out );
+            if ( i < goodBase64.size() && !failed )
+            {
+                std::string base64 = goodBase64;
+                base64[i] = 0 == i % 3 ? '=' : ( 1 == i % 3 ? '-' : char( 0xAB ) );
+                failed = 0 != TextTranscoding::base64Decode( bytesOf( base64 ), base64.size(), decoded ) ||
+                         0 != decoded.pubseekoff( 0, std::ios_base::cur, std::ios_base::out );
+            }
+            if ( failed ) std::cout << "Invalid character at " << i << " was not rejected!" << std::endl;
+        }
+        if ( failed ) { retCode = 4; break; }
+
+        {
+            ByteStreambuf decoded{ byteBuffer.data(), std::streamsize( byteBuffer.size() ) };
+            const std::string odd = "abc";
+            const std::string unpadded = "Zm9vYg";
+            const std::string badPadding = "Z===";
+            if ( 0 != TextTranscoding::hexDecode( bytesOf( odd ), odd.size(), decoded ) ||
+                 0 != TextTranscoding::base64Decode( bytesOf( unpadded ), unpadded.size(), decoded ) ||
+                 0 != TextTranscoding::base64Decode( bytesOf( badPadding ), badPadding.size(), decoded ) )
+            {
+                std::cout << "Malformed text lengths or padding were not rejected!" << std::endl;
+                retCode = 5;
+                break;
+            }
+        }
+
+        // TEST ENCODING WHAT HAS BEEN WRITTEN, AND ALL OR NOTHING WITHOUT ROOM
+        {
+            ByteStreambuf message{ byteBuffer.data(), std::streamsize( byteBuffer.size() ), std::ios_base::out };
+            message.sputn( bytes.data(), 40 );
+            ByteStreambuf text{ textBuffer.data(), 100, std::ios_base::out };
+            if ( 80 != TextTranscoding::hexEncodeWritten( message, text ) ||
+                 referenceHex( bytes.data(), 40 ) != written( textBuffer, 80 ) ||
+                 0 != TextTranscoding::base64EncodeWritten( message, text ) ||
+                 80 != text.pubseekoff( 0, std::ios_base::cur, std::ios_base::out ) )
+            {
+                std::cout << "Encoding what was written FAILED!" << std::endl;
+                retCode = 6;
+                break;
+            }
+
+            text.pubseekpos( 0 );
+            message.sputn( bytes.data() + 40, 20 );
+            if ( 80 != TextTranscoding::base64EncodeWritten( message, text ) ||
+                 referenceBase64( bytes.data(), 60 ) != written( textBuffer, 80 ) )
+            {
+                std::cout << "Base64 encoding what was written FAILED!" << std::endl;
+                retCode = 7;
+                break;
+            }
+        }
+
+        {
+            ByteStreambuf in{ byteBuffer.data(), 10, std::ios_base::in };
+            ByteStreambuf text{ textBuffer.data(), 19, std::ios_base::out };
+            if ( 0 != TextTranscoding::hexEncodeReadable( in, text ) ||
+                 0 != in.pubseekoff( 0, std::ios_base::cur, std::ios_base::in ) )
+            {
+                std::cout << "Encoding readable bytes without room should consume nothing!" << std::endl;
+                retCode = 8;
+                break;
+            }
+        }
+
+    } while( false );
+
+    return retCode;
+}
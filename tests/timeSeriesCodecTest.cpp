@@ -0,0 +1,151 @@
+/**
+* @file timeSeriesCodecTest.cpp
+* @brief Test Harness to Verify BitWriter, BitReader and the Time Series Encoders and Decoders
+* @authors Frank Reiser
+* @date Created on October 18, 2026
+*/
+
+#include "ByteStreambuf.h"
+#include "Serialization.h"
+#include "TimeSeriesCodec.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace ReiserRT::Utility;
+
+int main()
+{
+    int retCode = 0;
+
+    do {
+        // TEST BIT PACKING OF VARIOUS WIDTHS
+        unsigned char bitBuffer[ 64 ];
+        ByteStreambuf bitStreambuf{ bitBuffer, sizeof( bitBuffer ) };
+        BitWriter bitWriter{ bitStreambuf };
+        for ( unsigned width = 1; 65 != width; ++width )
+            bitWriter.writeBits( ~uint64_t( 0 ) / 3, width );
+        if ( bitWriter.good() )
+        {
+            std::cout << "Expected BitWriter to run out of room in a 64 byte buffer!" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        unsigned char bigBitBuffer[ 512 ];
+        ByteStreambuf bigBitStreambuf{ bigBitBuffer, sizeof( bigBitBuffer ) };
+        BitWriter bigBitWriter{ bigBitStreambuf };
+        for ( unsigned width = 0; 65 != width; ++width )
+            bigBitWriter.writeBits( ~uint64_t( 0 ) / 3 + width, width );
+        bigBitWriter.writeBits( 0x5, 3 );
+        if ( !bigBitWriter.flush() || ( 64 * 65 / 2 + 3 + 7 ) / 8 * 8 != bigBitWriter.bitsWritten() )
+        {
+            std::cout << "BitWriter FAILED! Wrote " << bigBitWriter.bitsWritten() << " bits" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        BitReader bitReader{ bigBitStreambuf };
+        for ( unsigned width = 0; 65 != width; ++width )
+        {
+            uint64_t value;
+            const uint64_t mask = 64 == width ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << width ) - 1;
+            if ( !bitReader.readBits( width, value ) || ( ( ~uint64_t( 0 ) / 3 + width ) & mask ) != value )
+            {
+                std::cout << "BitReader FAILED at width " << width << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        uint64_t lastBits;
+        if ( !bitReader.readBits( 3, lastBits ) || 0x5 != lastBits )
+        {
+            std::cout << "BitReader FAILED on final bits" << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // Finishing returns unconsumed bytes, leaving the get position at the end of what was written.
+        bitReader.finish();
+        const auto getPos = bigBitStreambuf.pubseekoff( 0, std::ios_base::cur, std::ios_base::in );
+        if ( std::streamoff( bigBitWriter.bitsWritten() / 8 ) != std::streamoff( getPos ) )
+        {
+            std::cout << "Expected get position of " << bigBitWriter.bitsWritten() / 8 << " after finish. Found "
+                      << getPos << std::endl;
+            retCode = 5;
+            break;
+        }
+
+        // TEST TIME SERIES ROUND TRIP
+        // Timestamps at a 1 ms cadence with occasional jitter and gaps, and slowly changing samples,
+        // along with some extreme values.
+        std::vector< int64_t > timestamps;
+        std::vector< double > samples;
+        int64_t t = 1700000000000000000LL;
+        for ( int i = 0; 10000 != i; ++i )
+        {
+            t += 1000000 + ( 0 == i % 100 ? 37 : 0 ) + ( 0 == i % 1000 ? 5000000 : 0 );
+            timestamps.push_back( t );
+            samples.push_back( std::round( 100.0 * std::sin( i * 0.01 ) ) / 100.0 );
+        }
+        timestamps.push_back( std::numeric_limits< int64_t >::min() );
+        timestamps.push_back( std::numeric_limits< int64_t >::max() );
+        timestamps.push_back( 0 );
+        samples.push_back( std::numeric_limits< double >::infinity() );
+        samples.push_back( -0.0 );
+        samples.push_back( std::numeric_limits< double >::denorm_min() );
+
+        std::vector< unsigned char > series( timestamps.size() * 16 + 16 );
+        ByteStreambuf seriesStreambuf{ series.data(), std::streamsize( series.size() ) };
+        typeToNet( uint32_t( timestamps.size() ), seriesStreambuf );
+        BitWriter seriesWriter{ seriesStreambuf };
+        DeltaOfDeltaEncoder timestampEncoder{ seriesWriter };
+        XorFloatEncoder sampleEncoder{ seriesWriter };
+        for ( size_t i = 0; timestamps.size() != i; ++i )
+        {
+            timestampEncoder.encode( timestamps[i] );
+            sampleEncoder.encode( samples[i] );
+        }
+        if ( !seriesWriter.flush() )
+        {
+            std::cout << "Time series writer ran out of room!" << std::endl;
+            retCode = 6;
+            break;
+        }
+
+        // Expect substantial savings over 16 bytes per sample. Decimal rounded samples do not XOR as well as
+        // repeated or integral ones, so we are conservative.
+        const auto encodedBytes = seriesWriter.bitsWritten() / 8;
+        if ( encodedBytes * 2 > timestamps.size() * 16 )
+        {
+            std::cout << "Expected at least 2x smaller encoding. Found " << encodedBytes << " bytes for "
+                      << timestamps.size() << " samples" << std::endl;
+            retCode = 7;
+            break;
+        }
+
+        const auto count = netToType< uint32_t >( seriesStreambuf );
+        BitReader seriesReader{ seriesStreambuf };
+        DeltaOfDeltaDecoder timestampDecoder{ seriesReader };
+        XorFloatDecoder sampleDecoder{ seriesReader };
+        for ( uint32_t i = 0; count != i; ++i )
+        {
+            int64_t timestamp;
+            double sample;
+            if ( !timestampDecoder.decode( timestamp ) || !sampleDecoder.decode( sample ) ||
+                 timestamp != timestamps[i] || 0 != memcmp( &sample, &samples[i], sizeof( sample ) ) )
+            {
+                std::cout << "Time series decode FAILED at sample " << i << std::endl;
+                retCode = 8;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+    } while( false );
+
+    return retCode;
+}